@@ -0,0 +1,47 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include "array_algorithm.h"
+
+constexpr std::size_t N = 1 << 22;
+using Arr = cont::Array<double, N>;
+
+template<class F>
+double measure(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<class Policy>
+void bench(const char *name, Policy policy) {
+    auto a = std::make_unique<Arr>();
+    auto b = std::make_unique<Arr>();
+    for (std::size_t i = 0; i < N; ++i) {
+        (*a)[i] = static_cast<double>((i * 2654435761u) % N);
+    }
+
+    double forEach = measure([&] { cont::for_each(policy, *a, [](double &x) { x = x * 1.5 + 1.0; }); });
+    double transform = measure([&] { cont::transform(policy, *a, *b, [](double x) { return x * x; }); });
+    double sum = 0;
+    double reduce = measure([&] { sum = cont::reduce(policy, *b, 0.0); });
+    Arr::ConstIterator hit;
+    double find = measure([&] { hit = cont::find(policy, *a, -1.0); });
+    double sort = measure([&] { cont::sort(policy, *a); });
+
+    std::cout << name
+              << "\tfor_each: " << forEach << " ms"
+              << "\ttransform: " << transform << " ms"
+              << "\treduce: " << reduce << " ms"
+              << "\tfind: " << find << " ms"
+              << "\tsort: " << sort << " ms"
+              << "\t(" << sum << ", " << (hit - a->cbegin()) << ")" << std::endl;
+}
+
+int main() {
+    std::cout << "threads: " << cont::ThreadPool::instance().size() << ", N = " << N << std::endl;
+    bench("seq  ", cont::execution::seq);
+    bench("unseq", cont::execution::unseq);
+    bench("par  ", cont::execution::par);
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <chrono>
+#include <iostream>
+#include "my_lib.h"
+
+template<std::size_t N>
+void bench(int iterations) {
+    auto *a = new cont::Array<int, N>();
+    auto *b = new cont::Array<int, N>();
+    a->fill(1);
+    b->fill(2);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        a->swap(*b);
+    }
+    auto swapTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        *a = *b;
+        (*b)[i % N] = i;
+    }
+    auto copyTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+
+    *a = *b;
+    (*b)[N - 1] += 1;
+    int less = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        less += (*a == *b) + (*a < *b);
+    }
+    auto compareTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+
+    std::cout << "N = " << N
+              << "\tswap: " << swapTime.count() / iterations << " ns"
+              << "\tcopy: " << copyTime.count() / iterations << " ns"
+              << "\tcompare: " << compareTime.count() / iterations << " ns"
+              << "\t(" << (*a)[0] + less << ")" << std::endl;
+    delete a;
+    delete b;
+}
+
+int main() {
+    bench<16>(1000000);
+    bench<256>(1000000);
+    bench<4096>(100000);
+    bench<65536>(10000);
+    bench<1048576>(200);
+    return 0;
+}
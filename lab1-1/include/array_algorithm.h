@@ -0,0 +1,350 @@
+#ifndef ARRAY_ALGORITHM_H
+#define ARRAY_ALGORITHM_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#if defined(__unix__)
+#include <unistd.h>
+#endif
+#include "my_lib.h"
+
+#if defined(__GNUC__)
+#define CONT_IVDEP _Pragma("GCC ivdep")
+#else
+#define CONT_IVDEP
+#endif
+
+namespace cont {
+    namespace execution {
+        struct sequenced_policy {
+        };
+
+        struct parallel_policy {
+        };
+
+        struct unsequenced_policy {
+        };
+
+        inline constexpr sequenced_policy seq{};
+        inline constexpr parallel_policy par{};
+        inline constexpr unsequenced_policy unseq{};
+    }
+
+    template<class P>
+    concept ExecutionPolicy = std::same_as<P, execution::sequenced_policy>
+                              || std::same_as<P, execution::parallel_policy>
+                              || std::same_as<P, execution::unsequenced_policy>;
+
+    // Fixed set of workers; run() hands out task indices and blocks until all of them are done.
+    class ThreadPool {
+    private:
+        std::vector<std::thread> workers;
+        std::mutex runMutex;
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::condition_variable done;
+        const std::function<void(std::size_t)> *job = nullptr;
+        std::size_t jobSize = 0;
+        std::atomic<std::size_t> next = 0;
+        std::size_t generation = 0;
+        std::size_t active = 0;
+        bool stop = false;
+
+        void work(const std::function<void(std::size_t)> &task, std::size_t count) {
+            for (std::size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+                task(i);
+            }
+        }
+
+        void loop() {
+            std::size_t seen = 0;
+            while (true) {
+                const std::function<void(std::size_t)> *task;
+                std::size_t count;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [&] { return stop || generation != seen; });
+                    if (stop) {
+                        return;
+                    }
+                    seen = generation;
+                    if (job == nullptr) {
+                        continue;
+                    }
+                    task = job;
+                    count = jobSize;
+                    ++active;
+                }
+                work(*task, count);
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--active == 0) {
+                    done.notify_all();
+                }
+            }
+        }
+
+    public:
+        explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency()) {
+            for (std::size_t i = 1; i < threads; ++i) {
+                workers.emplace_back([this] { loop(); });
+            }
+        }
+
+        ThreadPool(const ThreadPool &other) = delete;
+
+        ThreadPool &operator=(const ThreadPool &other) = delete;
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            wake.notify_all();
+            for (auto &worker : workers) {
+                worker.join();
+            }
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return workers.size() + 1;
+        }
+
+        // The calling thread takes part in the work. Tasks must not throw or call run() themselves.
+        void run(std::size_t count, const std::function<void(std::size_t)> &task) {
+            std::lock_guard<std::mutex> runLock(runMutex);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                job = &task;
+                jobSize = count;
+                next = 0;
+                ++generation;
+            }
+            wake.notify_all();
+            work(task, count);
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock, [&] { return active == 0; });
+            job = nullptr;
+        }
+
+        static ThreadPool &instance() {
+            static ThreadPool pool;
+            return pool;
+        }
+    };
+
+    namespace detail {
+        inline std::size_t cacheSize() {
+            static const std::size_t size = [] {
+                long l2 = 0;
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+                l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+                return l2 > 0 ? static_cast<std::size_t>(l2) : std::size_t{256 * 1024};
+            }();
+            return size;
+        }
+
+        // Each chunk touches about half of L2, leaving room for a second (output) stream.
+        inline std::size_t chunkSize(std::size_t n, std::size_t bytesPerElem) {
+            std::size_t byCache = std::max<std::size_t>(1, cacheSize() / 2 / bytesPerElem);
+            std::size_t byThreads = (n + ThreadPool::instance().size() - 1) / ThreadPool::instance().size();
+            return std::max<std::size_t>(1, std::min(byCache, byThreads));
+        }
+
+        template<class F>
+        void parallelChunks(std::size_t n, std::size_t bytesPerElem, F body) {
+            std::size_t chunk = chunkSize(n, bytesPerElem);
+            std::size_t chunks = (n + chunk - 1) / chunk;
+            if (chunks <= 1 || ThreadPool::instance().size() == 1) {
+                body(0, n);
+                return;
+            }
+            ThreadPool::instance().run(chunks, [&](std::size_t c) {
+                body(c * chunk, std::min(n, (c + 1) * chunk));
+            });
+        }
+
+        // Independent accumulators break the dependency chain so the loop vectorizes; op must be associative.
+        template<class T, class V, class Op>
+        V reduceLanes(const T *data, std::size_t n, V init, Op op) {
+            constexpr std::size_t Lanes = 8;
+            std::size_t i = 0;
+            if (n >= Lanes) {
+                V acc[Lanes];
+                for (std::size_t l = 0; l < Lanes; ++l) {
+                    acc[l] = V(data[l]);
+                }
+                for (i = Lanes; i + Lanes <= n; i += Lanes) {
+                    CONT_IVDEP
+                    for (std::size_t l = 0; l < Lanes; ++l) {
+                        acc[l] = op(acc[l], data[i + l]);
+                    }
+                }
+                for (std::size_t l = 0; l < Lanes; ++l) {
+                    init = op(init, acc[l]);
+                }
+            }
+            for (; i < n; ++i) {
+                init = op(init, data[i]);
+            }
+            return init;
+        }
+
+        template<class T, class V>
+        std::size_t findLanes(const T *data, std::size_t n, const V &value) {
+            constexpr std::size_t Lanes = 16;
+            std::size_t i = 0;
+            for (; i + Lanes <= n; i += Lanes) {
+                bool any = false;
+                CONT_IVDEP
+                for (std::size_t l = 0; l < Lanes; ++l) {
+                    any |= data[i + l] == value;
+                }
+                if (any) {
+                    break;
+                }
+            }
+            for (; i < n; ++i) {
+                if (data[i] == value) {
+                    return i;
+                }
+            }
+            return n;
+        }
+    }
+
+    template<ExecutionPolicy Policy, class T, std::size_t N, class F>
+    void for_each(Policy, Array<T, N> &arr, F f) {
+        T *data = arr.Data();
+        if constexpr (std::is_same_v<Policy, execution::parallel_policy>) {
+            detail::parallelChunks(N, sizeof(T), [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    f(data[i]);
+                }
+            });
+        } else if constexpr (std::is_same_v<Policy, execution::unsequenced_policy>) {
+            CONT_IVDEP
+            for (std::size_t i = 0; i < N; ++i) {
+                f(data[i]);
+            }
+        } else {
+            for (std::size_t i = 0; i < N; ++i) {
+                f(data[i]);
+            }
+        }
+    }
+
+    template<ExecutionPolicy Policy, class T, class U, std::size_t N, class F>
+    void transform(Policy, const Array<T, N> &in, Array<U, N> &out, F f) {
+        const T *src = in.Data();
+        U *dst = out.Data();
+        if constexpr (std::is_same_v<Policy, execution::parallel_policy>) {
+            detail::parallelChunks(N, sizeof(T) + sizeof(U), [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    dst[i] = f(src[i]);
+                }
+            });
+        } else if constexpr (std::is_same_v<Policy, execution::unsequenced_policy>) {
+            CONT_IVDEP
+            for (std::size_t i = 0; i < N; ++i) {
+                dst[i] = f(src[i]);
+            }
+        } else {
+            for (std::size_t i = 0; i < N; ++i) {
+                dst[i] = f(src[i]);
+            }
+        }
+    }
+
+    template<ExecutionPolicy Policy, class T, std::size_t N, class V, class Op = std::plus<> >
+    V reduce(Policy, const Array<T, N> &arr, V init, Op op = Op()) {
+        const T *data = arr.Data();
+        if constexpr (std::is_same_v<Policy, execution::parallel_policy>) {
+            std::size_t chunk = detail::chunkSize(N, sizeof(T));
+            std::vector<V> partial((N + chunk - 1) / chunk, V());
+            std::vector<char> used(partial.size(), 0);
+            detail::parallelChunks(N, sizeof(T), [&](std::size_t begin, std::size_t end) {
+                std::size_t c = begin / chunk;
+                for (std::size_t b = begin; b < end; b += chunk, ++c) {
+                    std::size_t e = std::min(end, b + chunk);
+                    partial[c] = detail::reduceLanes(data + b + 1, e - b - 1, V(data[b]), op);
+                    used[c] = 1;
+                }
+            });
+            for (std::size_t c = 0; c < partial.size(); ++c) {
+                if (used[c]) {
+                    init = op(init, partial[c]);
+                }
+            }
+            return init;
+        } else if constexpr (std::is_same_v<Policy, execution::unsequenced_policy>) {
+            return detail::reduceLanes(data, N, init, op);
+        } else {
+            for (std::size_t i = 0; i < N; ++i) {
+                init = op(init, data[i]);
+            }
+            return init;
+        }
+    }
+
+    template<ExecutionPolicy Policy, class T, std::size_t N, class Compare = std::less<> >
+    void sort(Policy, Array<T, N> &arr, Compare comp = Compare()) {
+        T *data = arr.Data();
+        if constexpr (std::is_same_v<Policy, execution::parallel_policy>) {
+            std::size_t parts = ThreadPool::instance().size();
+            if (parts == 1 || N < 2 * detail::chunkSize(N, sizeof(T))) {
+                std::sort(data, data + N, comp);
+                return;
+            }
+            std::size_t part = (N + parts - 1) / parts;
+            ThreadPool::instance().run(parts, [&](std::size_t p) {
+                std::sort(data + std::min(N, p * part), data + std::min(N, (p + 1) * part), comp);
+            });
+            for (std::size_t width = part; width < N; width *= 2) {
+                std::size_t pairs = (N + 2 * width - 1) / (2 * width);
+                ThreadPool::instance().run(pairs, [&](std::size_t p) {
+                    std::size_t begin = p * 2 * width;
+                    std::size_t middle = std::min(N, begin + width);
+                    std::size_t end = std::min(N, begin + 2 * width);
+                    std::inplace_merge(data + begin, data + middle, data + end, comp);
+                });
+            }
+        } else {
+            std::sort(data, data + N, comp);
+        }
+    }
+
+    // Returns an iterator to the first element equal to value, or arr.cend().
+    template<ExecutionPolicy Policy, class T, std::size_t N, class V>
+    typename Array<T, N>::ConstIterator find(Policy, const Array<T, N> &arr, const V &value) {
+        const T *data = arr.Data();
+        if constexpr (std::is_same_v<Policy, execution::parallel_policy>) {
+            std::atomic<std::size_t> found = N;
+            detail::parallelChunks(N, sizeof(T), [&](std::size_t begin, std::size_t end) {
+                if (begin >= found.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                std::size_t i = begin + detail::findLanes(data + begin, end - begin, value);
+                if (i == end) {
+                    return;
+                }
+                std::size_t current = found.load(std::memory_order_relaxed);
+                while (i < current && !found.compare_exchange_weak(current, i)) {
+                }
+            });
+            return arr.cbegin() + static_cast<std::ptrdiff_t>(found.load());
+        } else if constexpr (std::is_same_v<Policy, execution::unsequenced_policy>) {
+            return arr.cbegin() + static_cast<std::ptrdiff_t>(detail::findLanes(data, N, value));
+        } else {
+            return std::find(arr.cbegin(), arr.cend(), value);
+        }
+    }
+}
+
+#endif //ARRAY_ALGORITHM_H
@@ -0,0 +1,104 @@
+#ifndef CONTAINER_H
+#define CONTAINER_H
+
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+// Interface shared by every container in the labs: the Container concept, the static
+// ContainerBase and the opt-in virtual MyContainer wrapper.
+namespace cont {
+    template<class C>
+    concept Container = requires(const C &a, const C &b) {
+        typename C::value_type;
+        { a.size() } -> std::convertible_to<std::size_t>;
+        { a.max_size() } -> std::convertible_to<std::size_t>;
+        { a.empty() } -> std::convertible_to<bool>;
+        { a == b } -> std::convertible_to<bool>;
+        { a != b } -> std::convertible_to<bool>;
+    };
+
+    // Static (CRTP) base: shared members resolve at compile time and inline into hot loops.
+    template<class Derived>
+    class ContainerBase {
+    protected:
+        ContainerBase() = default;
+
+        ContainerBase(const ContainerBase &other) = default;
+
+        ~ContainerBase() = default;
+
+        ContainerBase &operator=(const ContainerBase &other) = default;
+
+    public:
+        [[nodiscard]] bool empty() const {
+            return static_cast<const Derived &>(*this).size() == 0;
+        }
+
+        bool operator!=(const Derived &other) const {
+            return !(static_cast<const Derived &>(*this) == other);
+        }
+    };
+
+    template<class T>
+    class MyContainer {
+    public:
+        MyContainer() = default;
+
+        MyContainer(const MyContainer &other) = default;
+
+        virtual ~MyContainer() = default;
+
+        MyContainer &operator=(const MyContainer &other) = default;
+
+        virtual bool operator==(const MyContainer &other) const = 0;
+
+        virtual bool operator!=(const MyContainer &other) const = 0;
+
+        [[nodiscard]] virtual std::size_t size() const = 0;
+
+        [[nodiscard]] virtual std::size_t max_size() const = 0;
+
+        [[nodiscard]] virtual bool empty() const = 0;
+    };
+
+    // Opt-in dynamic interface: wraps any Container into a MyContainer.
+    template<Container C>
+    class PolymorphicContainer : public C, public MyContainer<typename C::value_type> {
+        using Base = MyContainer<typename C::value_type>;
+
+    public:
+        using C::C;
+
+        PolymorphicContainer() = default;
+
+        explicit PolymorphicContainer(const C &other) : C(other) {
+        }
+
+        explicit PolymorphicContainer(C &&other) : C(std::move(other)) {
+        }
+
+        bool operator==(const Base &other) const override {
+            const auto *otherCont = dynamic_cast<const PolymorphicContainer *>(&other);
+            return otherCont != nullptr && static_cast<const C &>(*this) == static_cast<const C &>(*otherCont);
+        }
+
+        bool operator!=(const Base &other) const override {
+            return !(*this == other);
+        }
+
+        [[nodiscard]] std::size_t size() const override {
+            return C::size();
+        }
+
+        [[nodiscard]] std::size_t max_size() const override {
+            return C::max_size();
+        }
+
+        [[nodiscard]] bool empty() const override {
+            return C::empty();
+        }
+    };
+}
+
+#endif //CONTAINER_H
@@ -1,59 +1,157 @@
 #ifndef MY_LIB_H
 #define MY_LIB_H
 
+#include "container.h"
 #include <cstddef>
+#include <concepts>
+#include <cstring>
 #include <stdexcept>
 #include <compare>
+#include <memory>
+#include <new>
+#include <algorithm>
+#include <initializer_list>
+#include <type_traits>
+#include <bit>
+#include <iterator>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 namespace cont {
-    template<class T>
-    class MyContainer {
-    public:
-        MyContainer() = default;
-
-        MyContainer(const MyContainer &other) = default;
-
-        virtual ~MyContainer() = default;
-
-        MyContainer &operator=(const MyContainer &other) = default;
-
-        virtual bool operator==(const MyContainer &other) const = 0;
-
-        virtual bool operator!=(const MyContainer &other) const = 0;
-
-        [[nodiscard]] virtual std::size_t size() const = 0;
-
-        [[nodiscard]] virtual std::size_t max_size() const = 0;
-
-        [[nodiscard]] virtual bool empty() const = 0;
-    };
-
-
     template<class T, std::size_t N>
-    class Array : public MyContainer<T> {
+    class Array : public ContainerBase<Array<T, N> > {
         template<class Type, std::size_t>
         friend class Array;
 
     protected:
         using NoConstT = std::remove_const_t<T>;
+
+        // Arrays up to InlineBytes live inside the object, larger ones on a cache-line aligned heap block.
+        static constexpr std::size_t InlineBytes = 256;
+        static constexpr std::size_t Alignment = 64;
+        static constexpr bool IsInline = N != 0 && N * sizeof(NoConstT) <= InlineBytes;
+        static constexpr bool IsTrivial = std::is_trivially_copyable_v<NoConstT>;
+
         std::size_t cap = 0;
         NoConstT *data = nullptr;
+        alignas(NoConstT) unsigned char storage[IsInline ? N * sizeof(NoConstT) : 1];
+
+        void allocate() {
+            if constexpr (IsInline) {
+                this->data = reinterpret_cast<NoConstT *>(this->storage);
+            } else {
+                this->data = static_cast<NoConstT *>(
+                    ::operator new(N * sizeof(NoConstT), std::align_val_t{Alignment}));
+            }
+            this->cap = N;
+        }
+
+        void release() noexcept {
+            if (this->data != nullptr) {
+                std::destroy_n(this->data, this->cap);
+                if constexpr (!IsInline) {
+                    ::operator delete(this->data, std::align_val_t{Alignment});
+                }
+            }
+            this->data = nullptr;
+            this->cap = 0;
+        }
+
+        void constructFrom(const NoConstT *src) {
+            if constexpr (IsTrivial) {
+                std::memcpy(static_cast<void *>(this->data), src, N * sizeof(NoConstT));
+            } else {
+                std::uninitialized_copy_n(src, N, this->data);
+            }
+        }
+
+        void assignFrom(const NoConstT *src) {
+            if constexpr (IsTrivial) {
+                std::memcpy(static_cast<void *>(this->data), src, N * sizeof(NoConstT));
+            } else {
+                std::copy_n(src, N, this->data);
+            }
+        }
+
+        static constexpr bool IsBitwiseComparable =
+            std::is_integral_v<NoConstT> && std::has_unique_object_representations_v<NoConstT>;
+
+        // Index of the first element where a and b differ, or n if the ranges are equal.
+        static std::size_t firstMismatch(const NoConstT *a, const NoConstT *b, std::size_t n) {
+            const auto *left = reinterpret_cast<const unsigned char *>(a);
+            const auto *right = reinterpret_cast<const unsigned char *>(b);
+            std::size_t bytes = n * sizeof(NoConstT);
+            std::size_t i = 0;
+#if defined(__AVX2__)
+            for (; i + 32 <= bytes; i += 32) {
+                __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(left + i));
+                __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(right + i));
+                auto mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+                if (mask != 0xFFFFFFFFu) {
+                    return (i + std::countr_zero(~mask)) / sizeof(NoConstT);
+                }
+            }
+#elif defined(__SSE2__)
+            for (; i + 16 <= bytes; i += 16) {
+                __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(left + i));
+                __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(right + i));
+                auto mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)));
+                if (mask != 0xFFFFu) {
+                    return (i + std::countr_zero(~mask & 0xFFFFu)) / sizeof(NoConstT);
+                }
+            }
+#else
+            for (; i + 64 <= bytes && std::memcmp(left + i, right + i, 64) == 0; i += 64) {
+            }
+#endif
+            for (; i < bytes; ++i) {
+                if (left[i] != right[i]) {
+                    return i / sizeof(NoConstT);
+                }
+            }
+            return n;
+        }
+
+        static bool isRepeatedByte(const NoConstT &val) {
+            unsigned char bytes[sizeof(NoConstT)];
+            std::memcpy(bytes, &val, sizeof(NoConstT));
+            return std::all_of(bytes, bytes + sizeof(NoConstT), [&](unsigned char b) { return b == bytes[0]; });
+        }
 
         template<class IterType>
         class ArrayIterator {
         protected:
             friend class Array;
-            using NoConstIterType = std::remove_const_t<IterType>;
-            NoConstIterType *ptr = nullptr;
+            template<class>
+            friend class ArrayIterator;
+            IterType *ptr = nullptr;
 
-            explicit ArrayIterator(NoConstT *ptr) : ptr(ptr) {
+            explicit ArrayIterator(IterType *ptr) : ptr(ptr) {
             }
 
+        public:
+            using iterator_concept = std::contiguous_iterator_tag;
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = NoConstT;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType *;
+            using reference = IterType &;
+
+            ArrayIterator() = default;
+
             ArrayIterator(const ArrayIterator &other) = default;
 
-        public:
             ArrayIterator(ArrayIterator &&other) = default;
 
+            template<class Other> requires std::is_convertible_v<Other *, IterType *>
+            ArrayIterator(const ArrayIterator<Other> &other) : ptr(other.ptr) {
+            }
+
+            ArrayIterator &operator=(const ArrayIterator &other) = default;
+
+            ArrayIterator &operator=(ArrayIterator &&other) = default;
+
             ArrayIterator &operator++() {
                 ++ptr;
                 return *this;
@@ -76,6 +174,32 @@ namespace cont {
                 return tmp;
             }
 
+            ArrayIterator &operator+=(difference_type n) {
+                ptr += n;
+                return *this;
+            }
+
+            ArrayIterator &operator-=(difference_type n) {
+                ptr -= n;
+                return *this;
+            }
+
+            ArrayIterator operator+(difference_type n) const {
+                return ArrayIterator(ptr + n);
+            }
+
+            friend ArrayIterator operator+(difference_type n, const ArrayIterator &it) {
+                return it + n;
+            }
+
+            ArrayIterator operator-(difference_type n) const {
+                return ArrayIterator(ptr - n);
+            }
+
+            difference_type operator-(const ArrayIterator &other) const {
+                return this->ptr - other.ptr;
+            }
+
             bool operator==(const ArrayIterator &other) const {
                 return this->ptr == other.ptr;
             }
@@ -84,26 +208,56 @@ namespace cont {
                 return !(this->ptr == other.ptr);
             }
 
-            const T& operator*() {
+            std::strong_ordering operator<=>(const ArrayIterator &other) const {
+                return this->ptr <=> other.ptr;
+            }
+
+            reference operator*() const {
                 return *this->ptr;
             }
+
+            pointer operator->() const {
+                return this->ptr;
+            }
+
+            reference operator[](difference_type n) const {
+                return this->ptr[n];
+            }
         };
 
+        // Holds a pointer one past the current element, like std::reverse_iterator.
         template<class IterType>
         class ReverseArrayIterator {
         protected:
             friend class Array;
-            using NoConstIterType = std::remove_const_t<IterType>;
-            NoConstIterType *ptr = nullptr;
-
-            ReverseArrayIterator(const ReverseArrayIterator &other) = default;
+            template<class>
+            friend class ReverseArrayIterator;
+            IterType *ptr = nullptr;
 
-            explicit ReverseArrayIterator(T *ptr) : ptr(ptr) {
+            explicit ReverseArrayIterator(IterType *ptr) : ptr(ptr) {
             }
 
         public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = NoConstT;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType *;
+            using reference = IterType &;
+
+            ReverseArrayIterator() = default;
+
+            ReverseArrayIterator(const ReverseArrayIterator &other) = default;
+
             ReverseArrayIterator(ReverseArrayIterator &&other) = default;
 
+            template<class Other> requires std::is_convertible_v<Other *, IterType *>
+            ReverseArrayIterator(const ReverseArrayIterator<Other> &other) : ptr(other.ptr) {
+            }
+
+            ReverseArrayIterator &operator=(const ReverseArrayIterator &other) = default;
+
+            ReverseArrayIterator &operator=(ReverseArrayIterator &&other) = default;
+
             ReverseArrayIterator &operator++() {
                 --ptr;
                 return *this;
@@ -126,80 +280,127 @@ namespace cont {
                 return tmp;
             }
 
+            ReverseArrayIterator &operator+=(difference_type n) {
+                ptr -= n;
+                return *this;
+            }
+
+            ReverseArrayIterator &operator-=(difference_type n) {
+                ptr += n;
+                return *this;
+            }
+
+            ReverseArrayIterator operator+(difference_type n) const {
+                return ReverseArrayIterator(ptr - n);
+            }
+
+            friend ReverseArrayIterator operator+(difference_type n, const ReverseArrayIterator &it) {
+                return it + n;
+            }
+
+            ReverseArrayIterator operator-(difference_type n) const {
+                return ReverseArrayIterator(ptr + n);
+            }
+
+            difference_type operator-(const ReverseArrayIterator &other) const {
+                return other.ptr - this->ptr;
+            }
+
             bool operator==(const ReverseArrayIterator &other) const {
                 return this->ptr == other.ptr;
             }
 
             bool operator!=(const ReverseArrayIterator &other) const {
                 return !(this->ptr == other.ptr);
-            };
+            }
 
-            T operator*() {
-                return *this->ptr;
+            std::strong_ordering operator<=>(const ReverseArrayIterator &other) const {
+                return other.ptr <=> this->ptr;
+            }
+
+            reference operator*() const {
+                return *(this->ptr - 1);
+            }
+
+            pointer operator->() const {
+                return this->ptr - 1;
+            }
+
+            reference operator[](difference_type n) const {
+                return *(this->ptr - n - 1);
             }
         };
 
     public:
-        using Iterator = ArrayIterator<NoConstT>;
-        using ReverseIterator = ReverseArrayIterator<NoConstT>;
+        using value_type = T;
+        using Iterator = ArrayIterator<T>;
+        using ReverseIterator = ReverseArrayIterator<T>;
         using ConstIterator = ArrayIterator<const NoConstT>;
         using ConstReverseIterator = ReverseArrayIterator<const NoConstT>;
 
 
         Array() {
-            this->data = new NoConstT[N];
-            this->cap = N;
-            for (std::size_t i = 0; i < N; ++i) {
-                this->data[i] = 0;
-            }
+            allocate();
+            std::uninitialized_value_construct_n(this->data, N);
         }
 
         Array(std::initializer_list<NoConstT> init) {
             if (init.size() != N) {
                 throw std::invalid_argument("Incorrect initializer list size.");
             }
-            this->data = new NoConstT[N];
-            std::copy(init.begin(), init.end(), this->data);
-            this->cap = N;
+            allocate();
+            std::uninitialized_copy(init.begin(), init.end(), this->data);
         }
 
-        Array(const Array &other) {
-            cap = other.cap;
-            data = new NoConstT[cap];
-            std::copy(other.data, other.data + cap, this->data);
+        Array(const Array &other) : ContainerBase<Array>(other) {
+            if (other.cap != 0) {
+                allocate();
+                constructFrom(other.data);
+            }
         }
 
-        Array(Array &&other) noexcept {
-            this->cap = other.cap;
-            this->data = other.data;
-            other.data = nullptr;
-            other.cap = 0;
+        Array(Array &&other) noexcept(!IsInline || std::is_nothrow_move_constructible_v<NoConstT>) {
+            if constexpr (IsInline) {
+                allocate();
+                std::uninitialized_move_n(other.data, N, this->data);
+            } else {
+                this->cap = other.cap;
+                this->data = other.data;
+                other.data = nullptr;
+                other.cap = 0;
+            }
         }
 
-        ~Array() override {
-            delete[] this->data;
+        ~Array() {
+            release();
         }
 
         Array &operator=(const Array &other) {
             if (this != &other) {
-                if (this->data != other.data) {
-                    if (this->cap != other.cap) {
-                        this->cap = other.cap;
-                        delete[] this->data;
-                        this->data = new T[this->cap];
-                        std::copy(other.data, other.data + this->cap, this->data);
-                    }
-                    std::copy(other.data, other.data + this->cap, this->data);
+                if (other.cap == 0) {
+                    release();
+                } else if (this->cap == 0) {
+                    allocate();
+                    constructFrom(other.data);
+                } else {
+                    assignFrom(other.data);
                 }
             }
             return *this;
         }
 
-        Array &operator=(Array &&other) noexcept {
-            this->cap = other.cap;
-            this->data = other.data;
-            other.data = nullptr;
-            other.cap = 0;
+        Array &operator=(Array &&other) noexcept(!IsInline || std::is_nothrow_move_assignable_v<NoConstT>) {
+            if (this != &other) {
+                if constexpr (IsInline) {
+                    std::move(other.data, other.data + N, this->data);
+                } else {
+                    release();
+                    this->cap = other.cap;
+                    this->data = other.data;
+                    other.data = nullptr;
+                    other.cap = 0;
+                }
+            }
             return *this;
         }
 
@@ -226,6 +427,10 @@ namespace cont {
             return this->data;
         }
 
+        const T *Data() const {
+            return this->data;
+        }
+
         Iterator begin() const noexcept {
             return Iterator(this->data);
         }
@@ -243,53 +448,67 @@ namespace cont {
         }
 
         ReverseIterator rbegin() const noexcept {
-            return ReverseIterator(this->data + this->cap - 1);
+            return ReverseIterator(this->data + this->cap);
         }
 
         ReverseIterator rend() const noexcept {
-            return ReverseIterator(this->data - 1);
+            return ReverseIterator(this->data);
         }
 
         ConstReverseIterator crbegin() const noexcept {
-            return ConstReverseIterator(this->data + this->cap - 1);
+            return ConstReverseIterator(this->data + this->cap);
         }
 
         ConstReverseIterator crend() const noexcept {
-            return ConstReverseIterator(this->data - 1);
+            return ConstReverseIterator(this->data);
         }
 
-        [[nodiscard]] bool empty() const noexcept override {
-            return this->cap == 0;
-        }
-
-        [[nodiscard]] std::size_t size() const noexcept override {
+        [[nodiscard]] std::size_t size() const noexcept {
             return this->cap;
         }
 
-        [[nodiscard]] std::size_t max_size() const noexcept override {
+        [[nodiscard]] std::size_t max_size() const noexcept {
             return this->cap;
         }
 
         void fill(NoConstT val) {
-            for (std::size_t i = 0; i < this->cap; i++) {
-                this->data[i] = val;
+            if constexpr (IsTrivial) {
+                if (isRepeatedByte(val)) {
+                    unsigned char byte;
+                    std::memcpy(&byte, &val, 1);
+                    std::memset(static_cast<void *>(this->data), byte, this->cap * sizeof(NoConstT));
+                    return;
+                }
             }
+            std::fill_n(this->data, this->cap, val);
         }
 
-        void swap(Array &other) noexcept {
-            for (std::size_t i = 0; i < this->cap; i++) {
-                NoConstT tmp = this->data[i];
-                this->data[i] = other.data[i];
-                other.data[i] = tmp;
+        void swap(Array &other) noexcept(!IsInline || std::is_nothrow_swappable_v<NoConstT>) {
+            if constexpr (!IsInline) {
+                std::swap(this->data, other.data);
+                std::swap(this->cap, other.cap);
+            } else if constexpr (IsTrivial) {
+                unsigned char tmp[N * sizeof(NoConstT)];
+                std::memcpy(tmp, this->data, sizeof(tmp));
+                std::memcpy(static_cast<void *>(this->data), other.data, sizeof(tmp));
+                std::memcpy(static_cast<void *>(other.data), tmp, sizeof(tmp));
+            } else {
+                std::swap_ranges(this->data, this->data + N, other.data);
             }
         }
 
         template<std::size_t N2>
         std::strong_ordering operator<=>(const Array<T, N2> &other) const {
-            std::size_t n = std::min(N, N2);
-            for (std::size_t i = 0; i < n; i++) {
-                if (auto cmp = this->data[i] <=> other.data[i]; cmp != 0) {
-                    return cmp;
+            std::size_t n = std::min(this->cap, other.cap);
+            if constexpr (IsBitwiseComparable) {
+                if (std::size_t i = firstMismatch(this->data, other.data, n); i != n) {
+                    return this->data[i] <=> other.data[i];
+                }
+            } else {
+                for (std::size_t i = 0; i < n; i++) {
+                    if (auto cmp = this->data[i] <=> other.data[i]; cmp != 0) {
+                        return cmp;
+                    }
                 }
             }
 
@@ -300,30 +519,23 @@ namespace cont {
             return std::strong_ordering::equal;
         }
 
-        bool operator==(const MyContainer<T> &other) const override {
-            const auto *otherArr = dynamic_cast<const Array *>(&other);
-            if (this->cap != otherArr->cap) {
+        bool operator==(const Array &other) const {
+            if (this->cap != other.cap) {
                 return false;
             }
-            for (std::size_t i = 0; i < this->cap; i++) {
-                if (this->data[i] != otherArr->data[i]) {
-                    return false;
-                }
+            if constexpr (IsBitwiseComparable) {
+                return this->cap == 0 || std::memcmp(this->data, other.data, this->cap * sizeof(NoConstT)) == 0;
+            } else {
+                return std::equal(this->data, this->data + this->cap, other.data);
             }
-            return true;
         }
 
-        bool operator!=(const MyContainer<T> &other) const override {
-            return !(*this == other);
-        }
     };
+
+    template<class T, std::size_t N>
+    void swap(Array<T, N> &a, Array<T, N> &b) noexcept(noexcept(a.swap(b))) {
+        a.swap(b);
+    }
 }
 
 #endif //MY_LIB_H
-
-BigInt BigInt::operator-(const BigInt &other) const {
-    BigInt otherTmp = other;
-    otherTmp.isNegative = !otherTmp.isNegative;
-    BigInt result = *this + otherTmp;
-    return result;
-}
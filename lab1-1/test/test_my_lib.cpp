@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "my_lib.h"
+#include "array_algorithm.h"
 
 class TestFoo : public ::testing::Test {
 protected:
@@ -74,6 +75,223 @@ TEST_F(TestFoo, MoveConstructor) {
     EXPECT_EQ(arr2[0], 1);
 }
 
+TEST_F(TestFoo, DefaultZeroFilled) {
+    cont::Array<int, 100> small;
+    cont::Array<long long, 10000> big;
+    EXPECT_EQ(small[99], 0);
+    EXPECT_EQ(big[0], 0);
+    EXPECT_EQ(big[9999], 0);
+}
+
+TEST_F(TestFoo, LargeArrayAligned) {
+    cont::Array<double, 4096> big;
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big.Data()) % 64, 0);
+}
+
+TEST_F(TestFoo, Fill) {
+    cont::Array<int, 1000> a;
+    a.fill(-1);
+    EXPECT_EQ(a[0], -1);
+    EXPECT_EQ(a[999], -1);
+    a.fill(7);
+    EXPECT_EQ(a[500], 7);
+}
+
+TEST_F(TestFoo, SwapElements) {
+    cont::Array<int, 3> a{1, 2, 3};
+    cont::Array<int, 3> b{4, 5, 6};
+    a.swap(b);
+    EXPECT_EQ(a[0], 4);
+    EXPECT_EQ(b[2], 3);
+}
+
+TEST_F(TestFoo, CompareLarge) {
+    cont::Array<int, 5000> a;
+    cont::Array<int, 5000> b;
+    EXPECT_TRUE(a == b);
+    b[4999] = 1;
+    EXPECT_FALSE(a == b);
+    EXPECT_TRUE(a < b);
+}
+
+TEST_F(TestFoo, CompareBytes) {
+    cont::Array<unsigned char, 3> a{1, 2, 200};
+    cont::Array<unsigned char, 3> b{1, 3, 0};
+    EXPECT_TRUE(a < b);
+}
+
+TEST_F(TestFoo, CopyAndMoveAssignmentLarge) {
+    cont::Array<int, 1000> a;
+    a.fill(3);
+    cont::Array<int, 1000> b;
+    b = a;
+    EXPECT_EQ(b[999], 3);
+    cont::Array<int, 1000> c;
+    c = std::move(b);
+    EXPECT_EQ(c[0], 3);
+}
+
+TEST_F(TestFoo, SwapLargeIsPointerSwap) {
+    cont::Array<int, 1000> a;
+    cont::Array<int, 1000> b;
+    a.fill(1);
+    b.fill(2);
+    int *aData = a.Data();
+    int *bData = b.Data();
+    swap(a, b);
+    EXPECT_EQ(a.Data(), bData);
+    EXPECT_EQ(b.Data(), aData);
+    EXPECT_EQ(a[0], 2);
+    EXPECT_EQ(b[999], 1);
+}
+
+TEST_F(TestFoo, ReuseMovedFrom) {
+    cont::Array<int, 1000> a;
+    a.fill(5);
+    cont::Array<int, 1000> b(std::move(a));
+    EXPECT_TRUE(a.empty());
+    a = b;
+    EXPECT_EQ(a.size(), 1000);
+    EXPECT_EQ(a[10], 5);
+    b = std::move(a);
+    EXPECT_EQ(b[999], 5);
+}
+
+TEST_F(TestFoo, CompareFirstMismatch) {
+    cont::Array<int, 300> a;
+    for (std::size_t pos : {0, 7, 8, 31, 32, 150, 299}) {
+        cont::Array<int, 300> b;
+        b[pos] = -1;
+        EXPECT_TRUE(b < a);
+        EXPECT_TRUE(a > b);
+        EXPECT_TRUE(a != b);
+        b[pos] = 0;
+        EXPECT_TRUE(a == b);
+        EXPECT_TRUE((a <=> b) == 0);
+    }
+}
+
+TEST_F(TestFoo, CompareThroughBase) {
+    cont::PolymorphicContainer<cont::Array<int, 3> > a{1, 2, 3};
+    cont::PolymorphicContainer<cont::Array<int, 3> > b{1, 2, 3};
+    const cont::MyContainer<int> &base = b;
+    EXPECT_TRUE(a == base);
+    EXPECT_EQ(base.size(), 3);
+    b[2] = 4;
+    EXPECT_TRUE(a != base);
+}
+
+TEST_F(TestFoo, StaticInterface) {
+    static_assert(cont::Container<cont::Array<int, 3> >);
+    static_assert(!std::is_polymorphic_v<cont::Array<int, 3> >);
+    cont::Array<int, 0> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_FALSE(ar.empty());
+}
+
+TEST_F(TestFoo, IteratorConcepts) {
+    static_assert(std::contiguous_iterator<cont::Array<int, 3>::Iterator>);
+    static_assert(std::contiguous_iterator<cont::Array<int, 3>::ConstIterator>);
+    static_assert(std::random_access_iterator<cont::Array<int, 3>::ReverseIterator>);
+    static_assert(std::random_access_iterator<cont::Array<int, 3>::ConstReverseIterator>);
+    static_assert(std::ranges::contiguous_range<cont::Array<int, 3> >);
+}
+
+TEST_F(TestFoo, IteratorArithmetic) {
+    auto it = ar.begin();
+    it += 4;
+    EXPECT_EQ(*it, 4);
+    EXPECT_EQ(it[2], 6);
+    EXPECT_EQ(*(it - 1), 3);
+    EXPECT_EQ(ar.end() - ar.begin(), 10);
+    EXPECT_EQ(std::distance(ar.cbegin(), ar.cend()), 10);
+    EXPECT_TRUE(ar.begin() < ar.end());
+    EXPECT_EQ(std::to_address(ar.begin() + 3), ar.Data() + 3);
+    cont::Array<int, 10>::ConstIterator cit = ar.begin();
+    EXPECT_EQ(*cit, 0);
+}
+
+TEST_F(TestFoo, ReverseIteratorArithmetic) {
+    auto it = ar.rbegin();
+    EXPECT_EQ(*it, 9);
+    EXPECT_EQ(it[3], 6);
+    it += 9;
+    EXPECT_EQ(*it, 0);
+    EXPECT_EQ(++it, ar.rend());
+    EXPECT_EQ(ar.rend() - ar.rbegin(), 10);
+}
+
+TEST_F(TestFoo, StandardAlgorithms) {
+    cont::Array<int, 6> a{5, 3, 6, 1, 4, 2};
+    std::sort(a.begin(), a.end());
+    EXPECT_EQ(a[0], 1);
+    EXPECT_EQ(a[5], 6);
+    EXPECT_EQ(*std::lower_bound(a.cbegin(), a.cend(), 4), 4);
+    std::ranges::sort(a, std::greater<>());
+    EXPECT_EQ(a[0], 6);
+    std::sort(a.rbegin(), a.rend());
+    EXPECT_EQ(a[0], 6);
+    EXPECT_EQ(a[5], 1);
+}
+
+TEST(Algorithms, ForEachAndTransform) {
+    cont::Array<int, 100000> a;
+    cont::Array<long long, 100000> b;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = static_cast<int>(i);
+    }
+    cont::for_each(cont::execution::par, a, [](int &x) { x *= 2; });
+    cont::for_each(cont::execution::unseq, a, [](int &x) { x += 1; });
+    cont::transform(cont::execution::par, a, b, [](int x) { return static_cast<long long>(x) * 3; });
+    EXPECT_EQ(a[10], 21);
+    EXPECT_EQ(b[99999], 3LL * (2 * 99999 + 1));
+    cont::transform(cont::execution::seq, a, b, [](int x) { return static_cast<long long>(x); });
+    EXPECT_EQ(b[5], 11);
+}
+
+TEST(Algorithms, Reduce) {
+    cont::Array<double, 200000> a;
+    cont::for_each(cont::execution::seq, a, [](double &x) { x = 0.5; });
+    EXPECT_DOUBLE_EQ(cont::reduce(cont::execution::seq, a, 0.0), 100000.0);
+    EXPECT_DOUBLE_EQ(cont::reduce(cont::execution::unseq, a, 1.0), 100001.0);
+    EXPECT_DOUBLE_EQ(cont::reduce(cont::execution::par, a, 0.0), 100000.0);
+    cont::Array<int, 5> small{3, 1, 4, 1, 5};
+    EXPECT_EQ(cont::reduce(cont::execution::par, small, 0, [](int x, int y) { return std::max(x, y); }), 5);
+}
+
+TEST(Algorithms, Sort) {
+    cont::Array<int, 300001> a;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = static_cast<int>((i * 7919) % 300001);
+    }
+    cont::sort(cont::execution::par, a);
+    EXPECT_TRUE(std::is_sorted(a.Data(), a.Data() + a.size()));
+    cont::sort(cont::execution::seq, a, std::greater<>());
+    EXPECT_EQ(a[0], 300000);
+}
+
+TEST(Algorithms, Find) {
+    cont::Array<int, 100000> a;
+    a[70000] = 5;
+    a[90000] = 5;
+    cont::Array<int, 100000>::ConstIterator hit = cont::find(cont::execution::seq, a, 5);
+    EXPECT_EQ(hit, a.cbegin() + 70000);
+    EXPECT_EQ(*hit, 5);
+    EXPECT_EQ(cont::find(cont::execution::unseq, a, 5), a.cbegin() + 70000);
+    EXPECT_EQ(cont::find(cont::execution::par, a, 5), a.cbegin() + 70000);
+    EXPECT_EQ(cont::find(cont::execution::seq, a, 7), a.cend());
+    EXPECT_EQ(cont::find(cont::execution::unseq, a, 7), a.cend());
+    EXPECT_EQ(cont::find(cont::execution::par, a, 7), a.cend());
+}
+
+TEST(Algorithms, ThreadPool) {
+    cont::ThreadPool pool(4);
+    std::vector<int> hits(1000, 0);
+    pool.run(hits.size(), [&](std::size_t i) { hits[i]++; });
+    pool.run(hits.size(), [&](std::size_t i) { hits[i]++; });
+    EXPECT_EQ(std::count(hits.begin(), hits.end(), 2), 1000);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,85 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "list.h"
+#include "concurrent_list.h"
+
+// The current setup: a plain cont::List shared behind one mutex.
+class LockedList {
+private:
+    std::mutex mutex;
+    cont::List<long long> list;
+
+public:
+    void push_back(long long val) {
+        std::lock_guard<std::mutex> lock(mutex);
+        list.push_back(val);
+    }
+
+    bool try_pop_front(long long &out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (list.empty()) {
+            return false;
+        }
+        out = list.front();
+        list.pop_front();
+        return true;
+    }
+};
+
+template<class Queue>
+static double run(std::size_t threads, std::size_t items) {
+    Queue queue;
+    std::atomic<std::size_t> consumed{0};
+    std::atomic<long long> checksum{0};
+    std::size_t perProducer = items / threads;
+    std::size_t total = perProducer * threads;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (std::size_t p = 0; p < threads; p++) {
+        workers.emplace_back([&queue, perProducer] {
+            for (std::size_t i = 0; i < perProducer; i++) {
+                queue.push_back(static_cast<long long>(i));
+            }
+        });
+    }
+    for (std::size_t c = 0; c < threads; c++) {
+        workers.emplace_back([&] {
+            long long local = 0;
+            long long val;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (queue.try_pop_front(val)) {
+                    local += val;
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            checksum += local;
+        });
+    }
+    for (auto &t: workers) {
+        t.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(total) / seconds / 1e6;
+}
+
+int main(int argc, char **argv) {
+    std::size_t items = argc > 1 ? std::stoull(argv[1]) : 2'000'000;
+    std::cout << "producers=consumers, Mops/s (push+pop pairs)" << std::endl;
+    for (std::size_t threads: {1, 2, 4, 8, 16, 32}) {
+        double locked = run<LockedList>(threads, items);
+        double lockFree = run<cont::ConcurrentList<long long> >(threads, items);
+        std::cout << threads << " x " << threads
+                << "  mutex+List: " << locked
+                << "  ConcurrentList: " << lockFree << std::endl;
+    }
+    return 0;
+}
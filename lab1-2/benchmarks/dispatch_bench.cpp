@@ -0,0 +1,79 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include "list.h"
+
+// The previous shape of cont::List: every member call goes through the vtable.
+class VirtualList {
+public:
+    virtual ~VirtualList() = default;
+
+    virtual void push_back(int val) = 0;
+
+    [[nodiscard]] virtual std::size_t size() const = 0;
+
+    virtual cont::List<int>::Iterator begin() const = 0;
+
+    virtual cont::List<int>::Iterator end() const = 0;
+};
+
+class VirtualListImpl : public VirtualList {
+private:
+    cont::List<int> list;
+
+public:
+    void push_back(int val) override {
+        list.push_back(val);
+    }
+
+    [[nodiscard]] std::size_t size() const override {
+        return list.size();
+    }
+
+    cont::List<int>::Iterator begin() const override {
+        return list.begin();
+    }
+
+    cont::List<int>::Iterator end() const override {
+        return list.end();
+    }
+};
+
+template<class L>
+void run(const char *name, L &list, int count, int passes) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        list.push_back(i);
+    }
+    auto pushTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+
+    long long sum = 0;
+    start = std::chrono::steady_clock::now();
+    for (int p = 0; p < passes; ++p) {
+        for (auto it = list.begin(); it != list.end(); ++it) {
+            sum += *it;
+        }
+        sum += static_cast<long long>(list.size());
+    }
+    auto iterTime = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+
+    std::cout << name
+              << "\tpush_back: " << pushTime.count() / count << " ns/elem"
+              << "\titerate: " << iterTime.count() / (static_cast<double>(count) * passes) << " ns/elem"
+              << "\t(" << sum << ")" << std::endl;
+}
+
+int main(int argc, char **) {
+    const int count = 1000000;
+    const int passes = 20;
+
+    cont::List<int> direct;
+    run("static ", direct, count, passes);
+
+    std::unique_ptr<VirtualList> dynamic;
+    if (argc > 0) {
+        dynamic = std::make_unique<VirtualListImpl>();
+    }
+    run("virtual", *dynamic, count, passes);
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include "list.h"
+#include "intrusive_list.h"
+
+struct Buffer {
+    std::array<char, 128> bytes{};
+    cont::ListHook hook;
+
+    bool operator==(const Buffer &other) const {
+        return bytes == other.bytes;
+    }
+};
+
+template<class F>
+static double measure(F &&f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 1'000'000;
+    std::vector<Buffer> buffers(count);
+    std::vector<std::size_t> order(count);
+    for (std::size_t i = 0; i < count; i++) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+    double copyInsert = measure([&] {
+        cont::List<Buffer> l;
+        for (const Buffer &b: buffers) {
+            l.push_back(b);
+        }
+    });
+    cont::IntrusiveList<Buffer, &Buffer::hook> intrusive;
+    double linkInsert = measure([&] {
+        for (Buffer &b: buffers) {
+            intrusive.push_back(b);
+        }
+    });
+    double linkRemove = measure([&] {
+        for (std::size_t i: order) {
+            intrusive.erase(buffers[i]);
+        }
+    });
+
+    // Removal by pointer in a regular list needs a side table of iterators.
+    std::list<Buffer *> pointers;
+    std::vector<std::list<Buffer *>::iterator> positions(count);
+    double tableInsert = measure([&] {
+        for (std::size_t i = 0; i < count; i++) {
+            positions[i] = pointers.insert(pointers.end(), &buffers[i]);
+        }
+    });
+    double tableRemove = measure([&] {
+        for (std::size_t i: order) {
+            pointers.erase(positions[i]);
+        }
+    });
+
+    std::cout << "N=" << count << std::endl
+            << "cont::List<Buffer> push_back (copy): " << copyInsert << " ms" << std::endl
+            << "IntrusiveList push_back: " << linkInsert << " ms, erase(obj): " << linkRemove << " ms" << std::endl
+            << "std::list<Buffer*> + iterator table insert: " << tableInsert << " ms, erase: " << tableRemove
+            << " ms" << std::endl;
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "list.h"
+#include "../../lab2/include/big_int.h"
+
+template<class F>
+static double measure(F &&f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// make(i) builds a value; emplace(list, i) constructs the same value from its ctor arguments.
+template<class T, class Make, class Emplace>
+static void run(const std::string &name, std::size_t count, Make make, Emplace emplace) {
+    std::vector<T> source;
+    source.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        source.push_back(make(i));
+    }
+
+    double copyTime = measure([&] {
+        cont::List<T> l;
+        for (const T &val: source) {
+            l.push_back(val);
+        }
+    });
+    std::vector<T> moved = source;
+    double moveTime = measure([&] {
+        cont::List<T> l;
+        for (T &val: moved) {
+            l.push_back(std::move(val));
+        }
+    });
+    double temporaryTime = measure([&] {
+        cont::List<T> l;
+        for (std::size_t i = 0; i < count; i++) {
+            l.push_back(make(i));
+        }
+    });
+    double emplaceTime = measure([&] {
+        cont::List<T> l;
+        for (std::size_t i = 0; i < count; i++) {
+            emplace(l, i);
+        }
+    });
+
+    cont::List<T> from;
+    cont::List<T> to;
+    for (const T &val: source) {
+        from.push_back(val);
+        to.push_back(val);
+    }
+    double assignTime = measure([&] {
+        to = from;
+    });
+    double copyCtorTime = measure([&] {
+        cont::List<T> fresh(from);
+    });
+
+    std::cout << name
+            << " push_back(const&): " << copyTime << " ms"
+            << ", push_back(&&): " << moveTime << " ms"
+            << ", push_back(T(args)): " << temporaryTime << " ms"
+            << ", emplace_back(args): " << emplaceTime << " ms"
+            << ", operator= (reuse): " << assignTime << " ms"
+            << ", List(const List&): " << copyCtorTime << " ms" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 200'000;
+    run<std::string>("std::string", count, [](std::size_t i) {
+        return std::string(64, static_cast<char>('a' + i % 26));
+    }, [](cont::List<std::string> &l, std::size_t i) {
+        l.emplace_back(64, static_cast<char>('a' + i % 26));
+    });
+    run<BigInt>("BigInt     ", count, [](std::size_t i) {
+        return BigInt(static_cast<long long>(i) * 1'000'000'007LL);
+    }, [](cont::List<BigInt> &l, std::size_t i) {
+        l.emplace_back(static_cast<long long>(i) * 1'000'000'007LL);
+    });
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <string>
+#include <unistd.h>
+#include "list.h"
+
+static std::size_t residentBytes() {
+    std::ifstream statm("/proc/self/statm");
+    std::size_t pages = 0;
+    std::size_t resident = 0;
+    statm >> pages >> resident;
+    return resident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+template<class ListType>
+static void run(const std::string &name, std::size_t count) {
+    std::size_t rssBefore = residentBytes();
+    auto start = std::chrono::steady_clock::now();
+    {
+        ListType list;
+        for (std::size_t i = 0; i < count; i++) {
+            list.push_back(static_cast<int>(i));
+        }
+        auto filled = std::chrono::steady_clock::now();
+        std::size_t rssFilled = residentBytes();
+        long long checksum = 0;
+        while (!list.empty()) {
+            checksum += list.front();
+            list.pop_front();
+        }
+        auto drained = std::chrono::steady_clock::now();
+        std::cout << name
+                << " push_back: " << std::chrono::duration<double, std::milli>(filled - start).count() << " ms"
+                << ", pop_front: " << std::chrono::duration<double, std::milli>(drained - filled).count() << " ms"
+                << ", rss: " << (rssFilled - rssBefore) / (1024 * 1024) << " MiB"
+                << " (checksum " << checksum << ")" << std::endl;
+    }
+}
+
+int main(int argc, char **argv) {
+    // Freed heap pages stay resident, so pass "cont" or "std" to measure RSS in a clean process.
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 10'000'000;
+    std::string which = argc > 2 ? argv[2] : "all";
+    if (which != "std") {
+        run<cont::List<int> >("cont::List", count);
+    }
+    if (which != "cont") {
+        run<std::list<int> >("std::list ", count);
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include "list.h"
+
+template<class F>
+static double measure(F &&f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void run(std::size_t count) {
+    std::mt19937 rng(42);
+    std::vector<int> values(count);
+    for (int &v: values) {
+        v = static_cast<int>(rng());
+    }
+
+    cont::List<int> relinked;
+    cont::List<int> rebuilt;
+    std::list<int> standard;
+    for (int v: values) {
+        relinked.push_back(v);
+        rebuilt.push_back(v);
+        standard.push_back(v);
+    }
+
+    double sortTime = measure([&] {
+        relinked.sort();
+    });
+    // The old workaround: copy out, sort the vector, rebuild the list.
+    double rebuildTime = measure([&] {
+        std::vector<int> tmp;
+        tmp.reserve(rebuilt.size());
+        for (int v: rebuilt) {
+            tmp.push_back(v);
+        }
+        std::sort(tmp.begin(), tmp.end());
+        cont::List<int> fresh;
+        for (int v: tmp) {
+            fresh.push_back(v);
+        }
+        rebuilt = std::move(fresh);
+    });
+    double standardTime = measure([&] {
+        standard.sort();
+    });
+
+    std::cout << "N=" << count
+            << " List::sort: " << sortTime << " ms"
+            << ", vector+rebuild: " << rebuildTime << " ms"
+            << ", std::list::sort: " << standardTime << " ms"
+            << " (" << (relinked == rebuilt) << ")" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) {
+        run(std::stoull(argv[1]));
+        return 0;
+    }
+    for (std::size_t count: {1'000'000, 3'000'000, 10'000'000}) {
+        run(count);
+    }
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include "list.h"
+#include "unrolled_list.h"
+
+template<class F>
+static double measure(F &&f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<class ListType>
+static void run(const std::string &name, std::size_t count) {
+    ListType a;
+    for (std::size_t i = 0; i < count; i++) {
+        a.push_back(static_cast<int>(i));
+    }
+    long long sum = 0;
+    double scan = measure([&] {
+        for (int v: a) {
+            sum += v;
+        }
+    });
+    ListType b;
+    double copy = measure([&] {
+        b = a;
+    });
+    bool equal = false;
+    double compare = measure([&] {
+        equal = (a <=> b) == 0;
+    });
+    std::size_t probes = 100;
+    double walk = measure([&] {
+        for (std::size_t i = 0; i < probes; i++) {
+            sum += *a.cbegin().next(i * (count / probes));
+        }
+    });
+    std::cout << name
+            << " scan: " << scan << " ms"
+            << ", copy: " << copy << " ms"
+            << ", <=>: " << compare << " ms"
+            << ", next() x" << probes << ": " << walk << " ms"
+            << " (" << sum << ", " << equal << ")" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 1'000'000;
+    run<cont::List<int> >("cont::List        ", count);
+    run<cont::UnrolledList<int> >("cont::UnrolledList", count);
+    return 0;
+}
@@ -0,0 +1,270 @@
+#ifndef CONCURRENT_LIST_H
+#define CONCURRENT_LIST_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cont {
+    // Lock-free MPMC FIFO (Michael–Scott queue). push_back and pop_front may be called from any
+    // number of threads at once; unlinked nodes are reclaimed through hazard pointers.
+    // Construction and destruction must not race with other operations.
+    template<class T, class Allocator = std::allocator<T> >
+    class ConcurrentList {
+    private:
+        struct Node {
+            std::atomic<Node *> next{nullptr};
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T *value() {
+                return reinterpret_cast<T *>(storage);
+            }
+        };
+
+        using NodeAllocator = std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+        static constexpr std::size_t CacheLine = 64;
+        static constexpr std::size_t HazardSlots = 128;
+        static constexpr std::size_t RetireThreshold = 2 * HazardSlots * 2;
+
+        // One slot per in-flight operation; a thread claims a free slot for the duration of a call.
+        struct alignas(CacheLine) HazardRecord {
+            std::atomic<bool> active{false};
+            std::atomic<Node *> hazard[2] = {nullptr, nullptr};
+            std::vector<Node *> retired;
+        };
+
+        class Guard {
+        private:
+            HazardRecord *record;
+
+        public:
+            explicit Guard(ConcurrentList &list) : record(list.acquireRecord()) {
+            }
+
+            Guard(const Guard &other) = delete;
+
+            ~Guard() {
+                record->hazard[0].store(nullptr, std::memory_order_release);
+                record->hazard[1].store(nullptr, std::memory_order_release);
+                record->active.store(false, std::memory_order_release);
+            }
+
+            Guard &operator=(const Guard &other) = delete;
+
+            HazardRecord &operator*() const {
+                return *record;
+            }
+
+            HazardRecord *operator->() const {
+                return record;
+            }
+        };
+
+        [[no_unique_address]] NodeAllocator allocator;
+        alignas(CacheLine) std::atomic<Node *> head;
+        alignas(CacheLine) std::atomic<Node *> tail;
+        alignas(CacheLine) HazardRecord records[HazardSlots];
+
+        HazardRecord *acquireRecord() {
+            static thread_local std::size_t hint =
+                    std::hash<std::thread::id>()(std::this_thread::get_id()) % HazardSlots;
+            for (std::size_t attempt = 0;; attempt++) {
+                std::size_t idx = (hint + attempt) % HazardSlots;
+                HazardRecord &record = records[idx];
+                if (!record.active.load(std::memory_order_relaxed)
+                    && !record.active.exchange(true, std::memory_order_acquire)) {
+                    hint = idx;
+                    return &record;
+                }
+                if (attempt % HazardSlots == HazardSlots - 1) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        // Publishes src in the given hazard slot and re-reads until the published value is current.
+        static Node *protect(HazardRecord &record, std::size_t slot, const std::atomic<Node *> &src) {
+            Node *ptr = src.load(std::memory_order_relaxed);
+            while (true) {
+                record.hazard[slot].store(ptr, std::memory_order_seq_cst);
+                Node *current = src.load(std::memory_order_seq_cst);
+                if (current == ptr) {
+                    return ptr;
+                }
+                ptr = current;
+            }
+        }
+
+        Node *allocateNode() {
+            Node *node = NodeTraits::allocate(allocator, 1);
+            ::new(static_cast<void *>(node)) Node;
+            return node;
+        }
+
+        void freeNode(Node *node) noexcept {
+            std::destroy_at(node);
+            NodeTraits::deallocate(allocator, node, 1);
+        }
+
+        void retire(HazardRecord &record, Node *node) {
+            record.retired.push_back(node);
+            if (record.retired.size() < RetireThreshold) {
+                return;
+            }
+            std::vector<Node *> hazards;
+            hazards.reserve(HazardSlots * 2);
+            for (HazardRecord &other: records) {
+                for (auto &hazard: other.hazard) {
+                    if (Node *ptr = hazard.load(std::memory_order_seq_cst); ptr != nullptr) {
+                        hazards.push_back(ptr);
+                    }
+                }
+            }
+            std::sort(hazards.begin(), hazards.end());
+            std::size_t kept = 0;
+            for (Node *ptr: record.retired) {
+                if (std::binary_search(hazards.begin(), hazards.end(), ptr)) {
+                    record.retired[kept++] = ptr;
+                } else {
+                    freeNode(ptr);
+                }
+            }
+            record.retired.resize(kept);
+        }
+
+        void link(Node *node) {
+            Guard guard(*this);
+            while (true) {
+                Node *last = protect(*guard, 0, tail);
+                Node *next = last->next.load(std::memory_order_acquire);
+                if (last != tail.load(std::memory_order_acquire)) {
+                    continue;
+                }
+                if (next != nullptr) {
+                    // Tail is lagging behind; help the other producer finish.
+                    tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+                    continue;
+                }
+                if (last->next.compare_exchange_weak(next, node, std::memory_order_release,
+                                                     std::memory_order_relaxed)) {
+                    tail.compare_exchange_strong(last, node, std::memory_order_release, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        }
+
+        template<class Consume>
+        bool popWith(Consume consume) {
+            Guard guard(*this);
+            while (true) {
+                Node *first = protect(*guard, 0, head);
+                Node *last = tail.load(std::memory_order_acquire);
+                Node *next = first->next.load(std::memory_order_acquire);
+                guard->hazard[1].store(next, std::memory_order_seq_cst);
+                if (first != head.load(std::memory_order_seq_cst)) {
+                    continue;
+                }
+                if (next == nullptr) {
+                    return false;
+                }
+                if (first == last) {
+                    tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+                    continue;
+                }
+                if (head.compare_exchange_strong(first, next, std::memory_order_acq_rel,
+                                                 std::memory_order_relaxed)) {
+                    // next is the new dummy; only the winner of the CAS touches its value.
+                    consume(std::move(*next->value()));
+                    std::destroy_at(next->value());
+                    guard->hazard[0].store(nullptr, std::memory_order_release);
+                    guard->hazard[1].store(nullptr, std::memory_order_release);
+                    retire(*guard, first);
+                    return true;
+                }
+            }
+        }
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+
+        ConcurrentList() : ConcurrentList(Allocator()) {
+        }
+
+        explicit ConcurrentList(const Allocator &alloc) : allocator(alloc) {
+            Node *dummy = allocateNode();
+            head.store(dummy, std::memory_order_relaxed);
+            tail.store(dummy, std::memory_order_relaxed);
+        }
+
+        ConcurrentList(const ConcurrentList &other) = delete;
+
+        ~ConcurrentList() {
+            Node *node = head.load(std::memory_order_relaxed);
+            Node *next = node->next.load(std::memory_order_relaxed);
+            freeNode(node);
+            while (next != nullptr) {
+                node = next;
+                next = node->next.load(std::memory_order_relaxed);
+                std::destroy_at(node->value());
+                freeNode(node);
+            }
+            for (HazardRecord &record: records) {
+                for (Node *ptr: record.retired) {
+                    freeNode(ptr);
+                }
+            }
+        }
+
+        ConcurrentList &operator=(const ConcurrentList &other) = delete;
+
+        template<class... Args>
+        void emplace_back(Args &&... args) {
+            Node *node = allocateNode();
+            try {
+                std::construct_at(node->value(), std::forward<Args>(args)...);
+            } catch (...) {
+                freeNode(node);
+                throw;
+            }
+            link(node);
+        }
+
+        void push_back(const T &val) {
+            emplace_back(val);
+        }
+
+        void push_back(T &&val) {
+            emplace_back(std::move(val));
+        }
+
+        bool try_pop_front(T &out) {
+            return popWith([&out](T &&val) { out = std::move(val); });
+        }
+
+        std::optional<T> pop_front() {
+            std::optional<T> out;
+            popWith([&out](T &&val) { out.emplace(std::move(val)); });
+            return out;
+        }
+
+        // A snapshot: another thread may push or pop right after the check.
+        [[nodiscard]] bool empty() {
+            Guard guard(*this);
+            Node *first = protect(*guard, 0, head);
+            return first->next.load(std::memory_order_acquire) == nullptr;
+        }
+
+    };
+}
+
+#endif //CONCURRENT_LIST_H
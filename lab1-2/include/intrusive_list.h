@@ -0,0 +1,361 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <compare>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "list.h"
+
+namespace cont {
+    // Embedded links for IntrusiveList. Copying an object never copies its links.
+    class ListHook {
+    private:
+        template<class T, ListHook T::*Hook>
+        friend class IntrusiveList;
+
+        ListHook *next = nullptr;
+        ListHook *prev = nullptr;
+
+    public:
+        ListHook() = default;
+
+        ListHook(const ListHook &) {
+        }
+
+        ListHook &operator=(const ListHook &) {
+            return *this;
+        }
+
+        [[nodiscard]] bool is_linked() const {
+            return next != nullptr;
+        }
+    };
+
+    // Links objects that live elsewhere through their ListHook member: no allocation on insert,
+    // O(1) removal given the object itself. The list does not own its elements; an element must
+    // be erased before it is destroyed, and may be in at most one list per hook. T must be
+    // standard-layout so that the hook sits at a fixed offset from the start of the object.
+    template<class T, ListHook T::*Hook>
+    class IntrusiveList : public ContainerBase<IntrusiveList<T, Hook> > {
+        static_assert(std::is_standard_layout_v<T>, "IntrusiveList needs a standard-layout element type");
+
+    private:
+        // Circular: root.next is the first element, root.prev the last, so end() can be decremented.
+        ListHook root;
+        std::size_t len = 0;
+
+        static ListHook *hookOf(T &obj) {
+            return &(obj.*Hook);
+        }
+
+        // offsetof for the Hook member, taken on a fake (never dereferenced) aligned address.
+        static inline const std::ptrdiff_t hookOffset = [] {
+            constexpr std::uintptr_t base = alignof(T) < 64 ? 64 : alignof(T);
+            return static_cast<std::ptrdiff_t>(
+                reinterpret_cast<std::uintptr_t>(&(reinterpret_cast<T *>(base)->*Hook)) - base);
+        }();
+
+        static T *ownerOf(ListHook *hook) {
+            return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(hook) - hookOffset);
+        }
+
+        void linkBefore(ListHook *pos, ListHook *hook) {
+            if (hook->is_linked()) {
+                throw std::invalid_argument("IntrusiveList::insert. Element is already linked.");
+            }
+            hook->next = pos;
+            hook->prev = pos->prev;
+            pos->prev->next = hook;
+            pos->prev = hook;
+            len++;
+        }
+
+        ListHook *unlink(ListHook *hook) noexcept {
+            ListHook *next = hook->next;
+            hook->prev->next = next;
+            next->prev = hook->prev;
+            hook->next = nullptr;
+            hook->prev = nullptr;
+            len--;
+            return next;
+        }
+
+        void adopt(IntrusiveList &other) noexcept {
+            if (other.len == 0) {
+                root.next = &root;
+                root.prev = &root;
+            } else {
+                root.next = other.root.next;
+                root.prev = other.root.prev;
+                root.next->prev = &root;
+                root.prev->next = &root;
+            }
+            len = other.len;
+            other.root.next = &other.root;
+            other.root.prev = &other.root;
+            other.len = 0;
+        }
+
+    public:
+        using value_type = T;
+
+        template<class IterType>
+        class IntrusiveIterator {
+        private:
+            friend class IntrusiveList;
+            template<class>
+            friend class IntrusiveIterator;
+            ListHook *ptr = nullptr;
+
+            explicit IntrusiveIterator(ListHook *ptr) : ptr(ptr) {
+            }
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType *;
+            using reference = IterType &;
+
+            IntrusiveIterator() = default;
+
+            IntrusiveIterator(const IntrusiveIterator &other) = default;
+
+            IntrusiveIterator(IntrusiveIterator &&other) = default;
+
+            template<class Other> requires std::is_convertible_v<Other *, IterType *>
+            IntrusiveIterator(const IntrusiveIterator<Other> &other) : ptr(other.ptr) {
+            }
+
+            IntrusiveIterator &operator=(const IntrusiveIterator &other) = default;
+
+            IntrusiveIterator &operator=(IntrusiveIterator &&other) = default;
+
+            IntrusiveIterator &operator++() {
+                ptr = ptr->next;
+                return *this;
+            }
+
+            IntrusiveIterator &operator--() {
+                ptr = ptr->prev;
+                return *this;
+            }
+
+            IntrusiveIterator operator++(int) {
+                IntrusiveIterator tmp = *this;
+                ptr = ptr->next;
+                return tmp;
+            }
+
+            IntrusiveIterator operator--(int) {
+                IntrusiveIterator tmp = *this;
+                ptr = ptr->prev;
+                return tmp;
+            }
+
+            bool operator==(const IntrusiveIterator &other) const {
+                return ptr == other.ptr;
+            }
+
+            bool operator!=(const IntrusiveIterator &other) const {
+                return ptr != other.ptr;
+            }
+
+            reference operator*() const {
+                return *ownerOf(ptr);
+            }
+
+            pointer operator->() const {
+                return ownerOf(ptr);
+            }
+        };
+
+        using Iterator = IntrusiveIterator<T>;
+        using ConstIterator = IntrusiveIterator<const T>;
+        using ReverseIterator = std::reverse_iterator<Iterator>;
+        using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+        IntrusiveList() {
+            root.next = &root;
+            root.prev = &root;
+        }
+
+        IntrusiveList(const IntrusiveList &other) = delete;
+
+        IntrusiveList(IntrusiveList &&other) noexcept {
+            adopt(other);
+        }
+
+        ~IntrusiveList() {
+            clear();
+        }
+
+        IntrusiveList &operator=(const IntrusiveList &other) = delete;
+
+        IntrusiveList &operator=(IntrusiveList &&other) noexcept {
+            if (this != &other) {
+                clear();
+                adopt(other);
+            }
+            return *this;
+        }
+
+        T &front() {
+            if (len == 0) {
+                throw std::out_of_range("IntrusiveList::front. List is empty.");
+            }
+            return *ownerOf(root.next);
+        }
+
+        T &back() {
+            if (len == 0) {
+                throw std::out_of_range("IntrusiveList::back. List is empty.");
+            }
+            return *ownerOf(root.prev);
+        }
+
+        Iterator begin() {
+            return Iterator(root.next);
+        }
+
+        Iterator end() {
+            return Iterator(&root);
+        }
+
+        ConstIterator begin() const {
+            return cbegin();
+        }
+
+        ConstIterator end() const {
+            return cend();
+        }
+
+        ConstIterator cbegin() const {
+            return ConstIterator(root.next);
+        }
+
+        ConstIterator cend() const {
+            return ConstIterator(const_cast<ListHook *>(&root));
+        }
+
+        ReverseIterator rbegin() {
+            return ReverseIterator(end());
+        }
+
+        ReverseIterator rend() {
+            return ReverseIterator(begin());
+        }
+
+        ConstReverseIterator crbegin() const {
+            return ConstReverseIterator(cend());
+        }
+
+        ConstReverseIterator crend() const {
+            return ConstReverseIterator(cbegin());
+        }
+
+        Iterator iterator_to(T &obj) {
+            return Iterator(hookOf(obj));
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return len;
+        }
+
+        [[nodiscard]] std::size_t max_size() const {
+            return std::numeric_limits<std::size_t>::max();
+        }
+
+        void clear() noexcept {
+            ListHook *hook = root.next;
+            while (hook != &root) {
+                ListHook *next = hook->next;
+                hook->next = nullptr;
+                hook->prev = nullptr;
+                hook = next;
+            }
+            root.next = &root;
+            root.prev = &root;
+            len = 0;
+        }
+
+        Iterator insert(ConstIterator posIter, T &obj) {
+            linkBefore(posIter.ptr, hookOf(obj));
+            return Iterator(hookOf(obj));
+        }
+
+        Iterator erase(ConstIterator posIter) {
+            if (posIter.ptr == &root) {
+                throw std::out_of_range("IntrusiveList::erase. Offset is out of the collection.");
+            }
+            return Iterator(unlink(posIter.ptr));
+        }
+
+        // O(1): the element finds its neighbours through its own hook.
+        void erase(T &obj) {
+            if (!hookOf(obj)->is_linked()) {
+                throw std::invalid_argument("IntrusiveList::erase. Element is not linked.");
+            }
+            unlink(hookOf(obj));
+        }
+
+        void push_back(T &obj) {
+            linkBefore(&root, hookOf(obj));
+        }
+
+        void push_front(T &obj) {
+            linkBefore(root.next, hookOf(obj));
+        }
+
+        void pop_back() {
+            if (len == 0) {
+                throw std::out_of_range("IntrusiveList::pop_back. Size is 0");
+            }
+            unlink(root.prev);
+        }
+
+        void pop_front() {
+            if (len == 0) {
+                throw std::out_of_range("IntrusiveList::pop_front. Size is 0");
+            }
+            unlink(root.next);
+        }
+
+        void swap(IntrusiveList &other) noexcept {
+            IntrusiveList tmp(std::move(other));
+            other.adopt(*this);
+            adopt(tmp);
+        }
+
+        bool operator==(const IntrusiveList &other) const {
+            if (this->len != other.len) {
+                return false;
+            }
+            auto it2 = other.cbegin();
+            for (auto it1 = cbegin(); it1 != cend(); ++it1, ++it2) {
+                if (*it1 != *it2) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::strong_ordering operator<=>(const IntrusiveList &other) const {
+            auto it1 = cbegin();
+            auto it2 = other.cbegin();
+            for (; it1 != cend() && it2 != other.cend(); ++it1, ++it2) {
+                if (auto cmp = *it1 <=> *it2; cmp != 0) {
+                    return cmp;
+                }
+            }
+            return this->len <=> other.len;
+        }
+    };
+}
+
+#endif //INTRUSIVE_LIST_H
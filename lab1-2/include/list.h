@@ -1,150 +1,538 @@
 #ifndef LIST_H
 #define LIST_H
 
+#include "../../lab1-1/include/container.h"
+#include <atomic>
 #include <cstddef>
+#include <concepts>
 #include <compare>
 #include <memory>
 #include <stdexcept>
+#include <functional>
 #include <initializer_list>
+#include <type_traits>
+#include <utility>
 
 namespace cont {
-    template<class T>
-    class MyContainer {
+    // Hands out fixed-size node slots carved from geometrically growing blocks.
+    // Freed slots go to an intrusive free list and are reused before the next block is touched.
+    template<class Node, class Allocator>
+    class NodePool {
+    private:
+        struct BlockHeader {
+            void *nextBlock;
+            std::size_t count;
+        };
+
+        union Slot {
+            Slot *next;
+            BlockHeader header;
+            alignas(Node) unsigned char storage[sizeof(Node)];
+        };
+
+        using SlotAllocator = std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+        using SlotTraits = std::allocator_traits<SlotAllocator>;
+
+        static constexpr std::size_t FirstBlockSlots = 16;
+        static constexpr std::size_t MaxBlockSlots =
+                (std::size_t{1} << 16) / sizeof(Slot) > FirstBlockSlots
+                    ? (std::size_t{1} << 16) / sizeof(Slot)
+                    : FirstBlockSlots;
+
+        [[no_unique_address]] SlotAllocator allocator;
+        Slot *blocks = nullptr;
+        Slot *freeList = nullptr;
+        Slot *cursor = nullptr;
+        Slot *cursorEnd = nullptr;
+        std::size_t nextBlockSlots = FirstBlockSlots;
+
+        void grow() {
+            // Slot 0 of every block keeps the block chain and its size for release().
+            Slot *block = SlotTraits::allocate(allocator, nextBlockSlots + 1);
+            block->header.nextBlock = blocks;
+            block->header.count = nextBlockSlots + 1;
+            blocks = block;
+            cursor = block + 1;
+            cursorEnd = block + nextBlockSlots + 1;
+            if (nextBlockSlots < MaxBlockSlots) {
+                nextBlockSlots = nextBlockSlots * 2 < MaxBlockSlots ? nextBlockSlots * 2 : MaxBlockSlots;
+            }
+        }
+
+        void stealFrom(NodePool &other) noexcept {
+            blocks = other.blocks;
+            freeList = other.freeList;
+            cursor = other.cursor;
+            cursorEnd = other.cursorEnd;
+            nextBlockSlots = other.nextBlockSlots;
+            other.blocks = nullptr;
+            other.freeList = nullptr;
+            other.cursor = nullptr;
+            other.cursorEnd = nullptr;
+            other.nextBlockSlots = FirstBlockSlots;
+        }
+
     public:
-        MyContainer() = default;
+        NodePool() = default;
+
+        explicit NodePool(const Allocator &alloc) : allocator(alloc) {
+        }
+
+        NodePool(const NodePool &other) = delete;
+
+        NodePool(NodePool &&other) noexcept : allocator(std::move(other.allocator)) {
+            stealFrom(other);
+        }
+
+        ~NodePool() {
+            release();
+        }
+
+        NodePool &operator=(const NodePool &other) = delete;
+
+        NodePool &operator=(NodePool &&other) noexcept {
+            if (this != &other) {
+                release();
+                allocator = std::move(other.allocator);
+                stealFrom(other);
+            }
+            return *this;
+        }
+
+        Allocator get_allocator() const {
+            return Allocator(allocator);
+        }
+
+        Node *allocate() {
+            Slot *slot;
+            if (freeList != nullptr) {
+                slot = freeList;
+                freeList = freeList->next;
+            } else {
+                if (cursor == cursorEnd) {
+                    grow();
+                }
+                slot = cursor++;
+            }
+            return reinterpret_cast<Node *>(slot->storage);
+        }
+
+        void deallocate(Node *node) noexcept {
+            Slot *slot = reinterpret_cast<Slot *>(node);
+            slot->next = freeList;
+            freeList = slot;
+        }
+
+        // Returns every block to the allocator; all nodes must already be destroyed.
+        void release() noexcept {
+            while (blocks != nullptr) {
+                Slot *next = static_cast<Slot *>(blocks->header.nextBlock);
+                SlotTraits::deallocate(allocator, blocks, blocks->header.count);
+                blocks = next;
+            }
+            freeList = nullptr;
+            cursor = nullptr;
+            cursorEnd = nullptr;
+            nextBlockSlots = FirstBlockSlots;
+        }
+
+        void swap(NodePool &other) noexcept {
+            std::swap(allocator, other.allocator);
+            std::swap(blocks, other.blocks);
+            std::swap(freeList, other.freeList);
+            std::swap(cursor, other.cursor);
+            std::swap(cursorEnd, other.cursorEnd);
+            std::swap(nextBlockSlots, other.nextBlockSlots);
+        }
+    };
+
+    // Node pool for containers whose nodes move between instances (List::splice and merge).
+    // Every slot remembers the slab it was carved from, and each slab counts its slots that have
+    // not been given back yet. A node is always freed into the pool of the container holding it
+    // at that moment, so pools never share mutable state and containers that exchanged nodes can
+    // still be used from different threads. release() gives back the free and never-used slots;
+    // a slab is returned to the allocator by whichever pool gives back its last slot, so pools
+    // that exchange nodes must have equal allocators.
+    template<class Node, class Allocator>
+    class SlabNodePool {
+    private:
+        struct SlabHeader {
+            std::atomic<std::size_t> outstanding;
+            std::size_t count;
+
+            SlabHeader(std::size_t outstanding, std::size_t count) : outstanding(outstanding), count(count) {
+            }
+        };
+
+        struct Slot {
+            union {
+                Slot *next;
+                alignas(Node) unsigned char storage[sizeof(Node)];
+            };
+
+            SlabHeader *slab;
+        };
+
+        using SlotAllocator = std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+        using SlotTraits = std::allocator_traits<SlotAllocator>;
+
+        static_assert(alignof(Slot) >= alignof(SlabHeader));
+        static constexpr std::size_t HeaderSlots = (sizeof(SlabHeader) + sizeof(Slot) - 1) / sizeof(Slot);
+        static constexpr std::size_t FirstSlabSlots = 16;
+        static constexpr std::size_t MaxSlabSlots =
+                (std::size_t{1} << 16) / sizeof(Slot) > FirstSlabSlots
+                    ? (std::size_t{1} << 16) / sizeof(Slot)
+                    : FirstSlabSlots;
+
+        [[no_unique_address]] SlotAllocator allocator;
+        Slot *freeList = nullptr;
+        SlabHeader *currentSlab = nullptr;
+        Slot *cursor = nullptr;
+        Slot *cursorEnd = nullptr;
+        std::size_t nextSlabSlots = FirstSlabSlots;
+
+        void grow() {
+            // The first HeaderSlots slots of a slab hold its header.
+            std::size_t count = HeaderSlots + nextSlabSlots;
+            Slot *block = SlotTraits::allocate(allocator, count);
+            currentSlab = ::new(static_cast<void *>(block)) SlabHeader(nextSlabSlots, count);
+            cursor = block + HeaderSlots;
+            cursorEnd = block + count;
+            if (nextSlabSlots < MaxSlabSlots) {
+                nextSlabSlots = nextSlabSlots * 2 < MaxSlabSlots ? nextSlabSlots * 2 : MaxSlabSlots;
+            }
+        }
+
+        // Gives back n slots of slab, freeing it if they were the last ones.
+        void dropSlots(SlabHeader *slab, std::size_t n) noexcept {
+            if (slab->outstanding.fetch_sub(n, std::memory_order_acq_rel) == n) {
+                std::size_t count = slab->count;
+                std::destroy_at(slab);
+                SlotTraits::deallocate(allocator, reinterpret_cast<Slot *>(slab), count);
+            }
+        }
+
+        void stealFrom(SlabNodePool &other) noexcept {
+            freeList = std::exchange(other.freeList, nullptr);
+            currentSlab = std::exchange(other.currentSlab, nullptr);
+            cursor = std::exchange(other.cursor, nullptr);
+            cursorEnd = std::exchange(other.cursorEnd, nullptr);
+            nextSlabSlots = std::exchange(other.nextSlabSlots, FirstSlabSlots);
+        }
+
+    public:
+        SlabNodePool() = default;
+
+        explicit SlabNodePool(const Allocator &alloc) : allocator(alloc) {
+        }
 
-        MyContainer(const MyContainer &other) = default;
+        SlabNodePool(const SlabNodePool &other) = delete;
 
-        virtual ~MyContainer() = default;
+        SlabNodePool(SlabNodePool &&other) noexcept : allocator(std::move(other.allocator)) {
+            stealFrom(other);
+        }
 
-        MyContainer &operator=(const MyContainer &other) = default;
+        ~SlabNodePool() {
+            release();
+        }
 
-        virtual bool operator==(const MyContainer &other) const = 0;
+        SlabNodePool &operator=(const SlabNodePool &other) = delete;
 
-        virtual bool operator!=(const MyContainer &other) const = 0;
+        SlabNodePool &operator=(SlabNodePool &&other) noexcept {
+            if (this != &other) {
+                release();
+                allocator = std::move(other.allocator);
+                stealFrom(other);
+            }
+            return *this;
+        }
 
-        [[nodiscard]] virtual std::size_t size() const  = 0;
+        Allocator get_allocator() const {
+            return Allocator(allocator);
+        }
 
-        [[nodiscard]] virtual std::size_t max_size() const = 0;
+        Node *allocate() {
+            Slot *slot;
+            if (freeList != nullptr) {
+                slot = freeList;
+                freeList = freeList->next;
+            } else {
+                if (cursor == cursorEnd) {
+                    grow();
+                }
+                slot = cursor++;
+                slot->slab = currentSlab;
+            }
+            return reinterpret_cast<Node *>(slot->storage);
+        }
 
-        [[nodiscard]] virtual bool empty() const = 0;
+        // node may come from any pool with an equal allocator.
+        void deallocate(Node *node) noexcept {
+            Slot *slot = reinterpret_cast<Slot *>(node);
+            slot->next = freeList;
+            freeList = slot;
+        }
+
+        // Gives back every slot this pool holds; nodes still in use must be deallocated first.
+        // Neighbouring free slots mostly share a slab, so they are given back in runs.
+        void release() noexcept {
+            if (cursor != cursorEnd) {
+                dropSlots(currentSlab, static_cast<std::size_t>(cursorEnd - cursor));
+            }
+            SlabHeader *slab = nullptr;
+            std::size_t run = 0;
+            for (Slot *slot = freeList; slot != nullptr;) {
+                Slot *next = slot->next;
+                if (slot->slab != slab) {
+                    if (run > 0) {
+                        dropSlots(slab, run);
+                    }
+                    slab = slot->slab;
+                    run = 0;
+                }
+                run++;
+                slot = next;
+            }
+            if (run > 0) {
+                dropSlots(slab, run);
+            }
+            freeList = nullptr;
+            currentSlab = nullptr;
+            cursor = nullptr;
+            cursorEnd = nullptr;
+            nextSlabSlots = FirstSlabSlots;
+        }
+
+        void swap(SlabNodePool &other) noexcept {
+            std::swap(allocator, other.allocator);
+            std::swap(freeList, other.freeList);
+            std::swap(currentSlab, other.currentSlab);
+            std::swap(cursor, other.cursor);
+            std::swap(cursorEnd, other.cursorEnd);
+            std::swap(nextSlabSlots, other.nextSlabSlots);
+        }
     };
 
     template<class T, class Allocator = std::allocator<T> >
-    class List : public MyContainer<T> {
+    class List : public ContainerBase<List<T, Allocator> > {
     private:
         using noConstT = std::remove_const_t<T>;
         struct Node {
             noConstT data;
-            Node *next;
-            Node *prev;
+            Node *next = nullptr;
+            Node *prev = nullptr;
+
+            template<class... Args>
+            explicit Node(std::in_place_t, Args &&... args) : data(std::forward<Args>(args)...) {
+            }
         };
 
-        using NodeAllocator = std::allocator_traits<std::allocator<int> >::template rebind_alloc<Node>;
-        NodeAllocator allocator;
+        SlabNodePool<Node, Allocator> pool;
 
         Node *head = nullptr;
         Node *tail = nullptr;
         std::size_t len = 0;
 
-        void createHead(noConstT val) {
-            Node *head = allocator.allocate(sizeof(Node));
-            head->data = val;
-            head->next = nullptr;
-            head->prev = nullptr;
-            this->head = head;
-            this->tail = head;
-            this->len = 1;
-        }
-
-        Node *createNode(noConstT val) {
-            Node *node = allocator.allocate(sizeof(Node));
-            node->data = val;
-            node->next = nullptr;
-            node->prev = nullptr;
+        // Last node reached by at()/operator[]; walks start from it when it is the closest anchor.
+        Node *cursor = nullptr;
+        std::size_t cursorIndex = 0;
+
+        // Builds the element directly in pooled node storage, with no temporary in between.
+        template<class... Args>
+        Node *createNode(Args &&... args) {
+            Node *node = pool.allocate();
+            try {
+                std::construct_at(node, std::in_place, std::forward<Args>(args)...);
+            } catch (...) {
+                pool.deallocate(node);
+                throw;
+            }
             return node;
         }
 
-        void pushBack(noConstT val) {
-            Node *node = createNode(val);
-            tail->next = node;
-            node->prev = tail;
-            tail = node;
-            len++;
+        void destroyNode(Node *node) noexcept {
+            std::destroy_at(node);
+            pool.deallocate(node);
         }
 
         void deleteList() {
             while (head != nullptr) {
                 Node *next = head->next;
-                allocator.deallocate(head, sizeof(Node));
+                destroyNode(head);
                 head = next;
             }
+            pool.release();
             head = nullptr;
             tail = nullptr;
             len = 0;
+            cursor = nullptr;
+        }
+
+        // Nodes handed over to another list are later freed into its pool.
+        void checkAllocator(const List &other) const {
+            if constexpr (!std::allocator_traits<Allocator>::is_always_equal::value) {
+                if (!(pool.get_allocator() == other.pool.get_allocator())) {
+                    throw std::invalid_argument("List. Allocators of the two lists are not equal.");
+                }
+            }
+        }
+
+        // Detaches [first, last] from the chain; the nodes keep their own links.
+        void unlinkRange(Node *first, Node *last, std::size_t count) noexcept {
+            cursor = nullptr;
+            if (first->prev != nullptr) {
+                first->prev->next = last->next;
+            } else {
+                head = last->next;
+            }
+            if (last->next != nullptr) {
+                last->next->prev = first->prev;
+            } else {
+                tail = first->prev;
+            }
+            len -= count;
+        }
+
+        // Links the detached chain [first, last] in front of pos (nullptr means the end).
+        void linkRange(Node *pos, Node *first, Node *last, std::size_t count) noexcept {
+            if (pos == head) {
+                cursorIndex += count;
+            } else if (pos != nullptr) {
+                cursor = nullptr;
+            }
+            Node *prev = pos != nullptr ? pos->prev : tail;
+            first->prev = prev;
+            last->next = pos;
+            if (prev != nullptr) {
+                prev->next = first;
+            } else {
+                head = first;
+            }
+            if (pos != nullptr) {
+                pos->prev = last;
+            } else {
+                tail = last;
+            }
+            len += count;
+        }
+
+        template<class Compare>
+        static Node *mergeRuns(Node *a, Node *b, Compare &comp) {
+            Node *result = nullptr;
+            Node **out = &result;
+            while (a != nullptr && b != nullptr) {
+                if (comp(b->data, a->data)) {
+                    *out = b;
+                    b = b->next;
+                } else {
+                    *out = a;
+                    a = a->next;
+                }
+                out = &(*out)->next;
+            }
+            *out = a != nullptr ? a : b;
+            return result;
+        }
+
+        void relinkPrev() noexcept {
+            cursor = nullptr;
+            Node *prev = nullptr;
+            for (Node *node = head; node != nullptr; node = node->next) {
+                node->prev = prev;
+                prev = node;
+            }
+            tail = prev;
+        }
+
+        // Walks from whichever of head, tail or the cached cursor is closest to pos.
+        Node *nodeAt(std::size_t pos) {
+            Node *node = head;
+            std::size_t idx = 0;
+            std::size_t dist = pos;
+            if (len - 1 - pos < dist) {
+                node = tail;
+                idx = len - 1;
+                dist = len - 1 - pos;
+            }
+            if (cursor != nullptr) {
+                std::size_t fromCursor = pos > cursorIndex ? pos - cursorIndex : cursorIndex - pos;
+                if (fromCursor < dist) {
+                    node = cursor;
+                    idx = cursorIndex;
+                }
+            }
+            for (; idx < pos; idx++) {
+                node = node->next;
+            }
+            for (; idx > pos; idx--) {
+                node = node->prev;
+            }
+            cursor = node;
+            cursorIndex = pos;
+            return node;
         }
 
     public:
+        using value_type = T;
+
+        using allocator_type = Allocator;
+
         List() {
             head = nullptr;
             tail = nullptr;
             len = 0;
         }
 
+        explicit List(const Allocator &alloc) : pool(alloc) {
+        }
+
         List(std::initializer_list<T> init) {
-            createHead(*(init.begin()));
-            auto it = init.begin();
-            ++it;
-            for (; it != init.end(); ++it) {
-                pushBack(*it);
+            for (const T &val: init) {
+                emplace_back(val);
             }
         }
 
-        List(const List &other) {
-            this->allocator = other.allocator;
-            if (other.head == nullptr) {
-                this->head = nullptr;
-                this->tail = nullptr;
-                this->len = 0;
-            } else {
-                createHead(other.head->data);
-                Node *p = other.head->next;
-                while (p != nullptr) {
-                    pushBack(p->data);
-                    p = p->next;
-                }
+        List(const List &other)
+            : pool(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+                other.pool.get_allocator())) {
+            for (Node *p = other.head; p != nullptr; p = p->next) {
+                emplace_back(p->data);
             }
         }
 
-        List(List &&other) noexcept {
+        List(List &&other) noexcept : pool(std::move(other.pool)) {
             head = other.head;
             tail = other.tail;
-            allocator = other.allocator;
             len = other.len;
+            other.cursor = nullptr;
             other.head = nullptr;
             other.tail = nullptr;
             other.len = 0;
         }
 
-        ~List() override {
+        ~List() {
             deleteList();
         }
 
         List &operator=(const List &other) {
             if (this != &other) {
-                this->deleteList();
-                this->allocator = other.allocator;
-                if (other.head != nullptr) {
-                    createHead(other.head->data);
-                    Node *ptr = other.head->next;
-                    while (ptr != nullptr) {
-                        pushBack(ptr->data);
-                        ptr = ptr->next;
+                if constexpr (std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value) {
+                    if (!(this->pool.get_allocator() == other.pool.get_allocator())) {
+                        this->deleteList();
+                        this->pool = SlabNodePool<Node, Allocator>(other.pool.get_allocator());
                     }
-                } else {
-                    head = nullptr;
-                    tail = nullptr;
-                    len = 0;
+                }
+                // Reuse the nodes we already own: assign over them, then grow or trim the tail.
+                Node *dst = head;
+                Node *src = other.head;
+                for (; dst != nullptr && src != nullptr; dst = dst->next, src = src->next) {
+                    dst->data = src->data;
+                }
+                for (; src != nullptr; src = src->next) {
+                    emplace_back(src->data);
+                }
+                while (len > other.len) {
+                    pop_back();
                 }
             }
             return *this;
@@ -152,7 +540,9 @@ namespace cont {
 
         List &operator=(List &&other) noexcept {
             if (this != &other) {
-                this->allocator = other.allocator;
+                this->deleteList();
+                this->pool = std::move(other.pool);
+                other.cursor = nullptr;
                 this->head = other.head;
                 this->tail = other.tail;
                 this->len = other.len;
@@ -163,20 +553,31 @@ namespace cont {
             return *this;
         }
 
-        virtual T &front() {
+        T &front() {
             if (head == nullptr) {
                 throw std::out_of_range("List::front. List doesn't exist.");
             }
             return head->data;
         }
 
-        virtual T &back() {
+        T &back() {
             if (tail == nullptr) {
                 throw std::out_of_range("List::back. List doesn't exist.");
             }
             return tail->data;
         }
 
+        T &at(std::size_t pos) {
+            if (pos >= len) {
+                throw std::out_of_range("List::at. Pos is out of the collection.");
+            }
+            return nodeAt(pos)->data;
+        }
+
+        T &operator[](std::size_t pos) {
+            return at(pos);
+        }
+
         template<class IterType>
         class ListIterator {
         private:
@@ -293,100 +694,83 @@ namespace cont {
         using ConstIterator = ListIterator<const Node>;
         using ConstReverseIterator = ReverseListIterator<const Node>;
 
-        virtual Iterator begin() const {
+        Iterator begin() const {
             return Iterator(head);
         }
 
-        virtual Iterator end() const {
+        Iterator end() const {
             return Iterator(nullptr);
         }
 
-        virtual ConstIterator cbegin() const {
+        ConstIterator cbegin() const {
             return ConstIterator(head);
         }
 
-        virtual ConstIterator cend() const {
+        ConstIterator cend() const {
             return ConstIterator(nullptr);
         }
 
-        virtual ReverseIterator rbegin() const {
+        ReverseIterator rbegin() const {
             return ReverseIterator(tail);
         }
 
-        virtual ReverseIterator rend() const {
+        ReverseIterator rend() const {
             return ReverseIterator(nullptr);
         }
 
-        virtual ConstReverseIterator crbegin() const {
+        ConstReverseIterator crbegin() const {
             return ConstReverseIterator(tail);
         }
 
-        virtual ConstReverseIterator crend() const {
+        ConstReverseIterator crend() const {
             return ConstReverseIterator(nullptr);
         }
 
-        [[nodiscard]] bool empty() const override {
-            return len == 0;
+        [[nodiscard]] std::size_t size() const {
+            return len;
         }
 
-        [[nodiscard]] std::size_t size() const override  {
-            return len;
+        Allocator get_allocator() const {
+            return pool.get_allocator();
         }
 
-        [[nodiscard]] std::size_t max_size() const override {
+        [[nodiscard]] std::size_t max_size() const {
             return len;
         }
 
-        virtual void clear() {
+        void clear() {
             deleteList();
         }
 
-        virtual void insert(ConstIterator posIter, noConstT val) {
-            if (posIter.ptr == head) {
-                if (posIter.ptr == nullptr) {
-                    head = createNode(val);
-                    tail = head;
-                    len = 1;
-                } else {
-                    Node* h = head;
-                    Node* newNode = createNode(val);
-                    newNode->next = h;
-                    h->prev = newNode;
-                    head = newNode;
-                    len++;
-                }
-            }
-            else if (posIter.ptr == nullptr) {
-                Node* newNode = createNode(val);
-                tail->next = newNode;
-                newNode->prev = tail;
-                tail = newNode;
-                len++;
-            } else {
-                Node* whereToPut = posIter.ptr;
-                Node* newNode = createNode(val);
-                Node* prev = whereToPut->prev;
-                prev->next = newNode;
-                newNode->next = whereToPut;
-                newNode->prev = prev;
-                whereToPut->prev = newNode;
-                len++;
-            }
+        template<class... Args>
+        Iterator emplace(ConstIterator posIter, Args &&... args) {
+            Node *node = createNode(std::forward<Args>(args)...);
+            linkRange(posIter.ptr, node, node, 1);
+            return Iterator(node);
+        }
+
+        Iterator insert(ConstIterator posIter, const noConstT &val) {
+            return emplace(posIter, val);
         }
 
-        virtual Iterator erase(ConstIterator posIter) {
+        Iterator insert(ConstIterator posIter, noConstT &&val) {
+            return emplace(posIter, std::move(val));
+        }
+
+        Iterator erase(ConstIterator posIter) {
             if (posIter.ptr == nullptr) {
                 throw std::out_of_range("ListIterator::erase. Offset is out of the collection.");
             }
+            cursor = nullptr;
             if (posIter.ptr == head) {
                 if (posIter.ptr == tail) {
-                    allocator.deallocate(posIter.ptr, sizeof(Node));
+                    destroyNode(posIter.ptr);
                     head = nullptr;
                     tail = nullptr;
                     len = 0;
                 } else {
                     Node* h = head->next;
-                    allocator.deallocate(posIter.ptr, sizeof(Node));
+                    destroyNode(posIter.ptr);
                     head = h;
                     head->prev = nullptr;
                     len--;
@@ -399,36 +783,39 @@ namespace cont {
             if (next != nullptr) {
                 prev->next = next;
                 next->prev = prev;
-                allocator.deallocate(node, sizeof(Node));
+                destroyNode(node);
                 len--;
                 return Iterator(next);
             }
             prev->next = nullptr;
             tail = prev;
-            allocator.deallocate(node, sizeof(Node));
+            destroyNode(node);
             len--;
             return Iterator(nullptr);
         }
 
-        virtual void push_back(noConstT val) {
-            Node* node = createNode(val);
-            if (head == nullptr) {
-                head = node;
-                tail = node;
-                len = 1;
-            } else {
-                Node* last = tail;
-                tail->next = node;
-                tail = node;
-                tail->prev = last;
-                len++;
-            }
+        template<class... Args>
+        T &emplace_back(Args &&... args) {
+            Node *node = createNode(std::forward<Args>(args)...);
+            linkRange(nullptr, node, node, 1);
+            return node->data;
+        }
+
+        void push_back(const noConstT &val) {
+            emplace_back(val);
         }
 
-        virtual void pop_back() {
+        void push_back(noConstT &&val) {
+            emplace_back(std::move(val));
+        }
+
+        void pop_back() {
             if (len == 0) {
                 throw std::out_of_range("ListIterator::pop_back. Size is 0");
             }
+            if (cursor == tail) {
+                cursor = nullptr;
+            }
             Node* rem = tail;
             if (len == 1) {
                 head = nullptr;
@@ -439,27 +826,33 @@ namespace cont {
                 len--;
                 tail->next = nullptr;
             }
-            allocator.deallocate(rem, sizeof(Node));
+            destroyNode(rem);
         }
 
-        virtual void push_front(noConstT val) {
-            Node* node = createNode(val);
-            if (head == nullptr) {
-                head = node;
-                tail = node;
-                len = 1;
-            } else {
-                node->next = head;
-                head->prev = node;
-                head = node;
-                len++;
-            }
+        template<class... Args>
+        T &emplace_front(Args &&... args) {
+            Node *node = createNode(std::forward<Args>(args)...);
+            linkRange(head, node, node, 1);
+            return node->data;
+        }
+
+        void push_front(const noConstT &val) {
+            emplace_front(val);
+        }
+
+        void push_front(noConstT &&val) {
+            emplace_front(std::move(val));
         }
 
-        virtual void pop_front() {
+        void pop_front() {
             if (len == 0) {
                 throw std::out_of_range("ListIterator::pop_front. Size is 0");
             }
+            if (cursor == head) {
+                cursor = nullptr;
+            } else {
+                cursorIndex--;
+            }
             Node* rem = head;
             if (len == 1) {
                 head = nullptr;
@@ -470,23 +863,16 @@ namespace cont {
                 len--;
                 head->prev = nullptr;
             }
-            allocator.deallocate(rem, sizeof(Node));
+            destroyNode(rem);
         }
 
-        virtual void resize(std::size_t newSize, noConstT val) {
+        void resize(std::size_t newSize, const noConstT &val) {
             if (newSize <= 0) {
                 throw std::out_of_range("ListIterator::resize. New size must be more than 0.");
             }
             if (len == newSize) {
                 return;
             }
-            if (len == 0) {
-                createHead(val);
-                while (len != newSize) {
-                    push_back(val);
-                }
-                return;
-            }
             if (len > newSize) {
                 while (len != newSize) {
                     pop_back();
@@ -500,7 +886,167 @@ namespace cont {
             }
         }
 
-        virtual void swap(List& other) noexcept {
+        void splice(ConstIterator posIter, List &other) {
+            if (&other == this || other.head == nullptr) {
+                return;
+            }
+            checkAllocator(other);
+            std::size_t count = other.len;
+            Node *first = other.head;
+            Node *last = other.tail;
+            other.unlinkRange(first, last, count);
+            linkRange(posIter.ptr, first, last, count);
+        }
+
+        void splice(ConstIterator posIter, List &other, ConstIterator it) {
+            Node *node = it.ptr;
+            if (node == nullptr) {
+                throw std::out_of_range("List::splice. Iterator is out of the collection.");
+            }
+            if (&other == this && (node == posIter.ptr || node->next == posIter.ptr)) {
+                return;
+            }
+            checkAllocator(other);
+            other.unlinkRange(node, node, 1);
+            linkRange(posIter.ptr, node, node, 1);
+        }
+
+        void splice(ConstIterator posIter, List &other, ConstIterator first, ConstIterator last) {
+            if (first == last) {
+                return;
+            }
+            Node *lastNode = last.ptr != nullptr ? last.ptr->prev : other.tail;
+            std::size_t count = 0;
+            for (Node *node = first.ptr; node != last.ptr; node = node->next) {
+                count++;
+            }
+            checkAllocator(other);
+            other.unlinkRange(first.ptr, lastNode, count);
+            linkRange(posIter.ptr, first.ptr, lastNode, count);
+        }
+
+        template<class Compare>
+        void merge(List &other, Compare comp) {
+            if (&other == this || other.head == nullptr) {
+                return;
+            }
+            checkAllocator(other);
+            head = mergeRuns(head, other.head, comp);
+            len += other.len;
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.len = 0;
+            relinkPrev();
+        }
+
+        void merge(List &other) {
+            merge(other, std::less<>());
+        }
+
+        // Stable bottom-up merge sort: nodes are relinked, values never move and nothing is allocated.
+        template<class Compare>
+        void sort(Compare comp) {
+            if (len < 2) {
+                return;
+            }
+            Node *bins[64] = {};
+            Node *node = head;
+            while (node != nullptr) {
+                Node *next = node->next;
+                node->next = nullptr;
+                Node *carry = node;
+                std::size_t i = 0;
+                for (; bins[i] != nullptr; i++) {
+                    carry = mergeRuns(bins[i], carry, comp);
+                    bins[i] = nullptr;
+                }
+                bins[i] = carry;
+                node = next;
+            }
+            Node *result = nullptr;
+            for (Node *bin: bins) {
+                if (bin != nullptr) {
+                    result = result != nullptr ? mergeRuns(bin, result, comp) : bin;
+                }
+            }
+            head = result;
+            relinkPrev();
+        }
+
+        void sort() {
+            sort(std::less<>());
+        }
+
+        template<class BinaryPredicate>
+        std::size_t unique(BinaryPredicate pred) {
+            std::size_t removed = 0;
+            if (head == nullptr) {
+                return removed;
+            }
+            Node *node = head;
+            while (node->next != nullptr) {
+                Node *next = node->next;
+                if (pred(node->data, next->data)) {
+                    unlinkRange(next, next, 1);
+                    destroyNode(next);
+                    removed++;
+                } else {
+                    node = next;
+                }
+            }
+            return removed;
+        }
+
+        std::size_t unique() {
+            return unique(std::equal_to<>());
+        }
+
+        template<class Predicate>
+        std::size_t remove_if(Predicate pred) {
+            std::size_t removed = 0;
+            Node *node = head;
+            while (node != nullptr) {
+                Node *next = node->next;
+                if (pred(node->data)) {
+                    unlinkRange(node, node, 1);
+                    destroyNode(node);
+                    removed++;
+                }
+                node = next;
+            }
+            return removed;
+        }
+
+        // val may be an element of this list: its node is erased last, after every comparison.
+        std::size_t remove(const noConstT &val) {
+            std::size_t removed = 0;
+            Node *aliased = nullptr;
+            Node *node = head;
+            while (node != nullptr) {
+                Node *next = node->next;
+                if (node->data == val) {
+                    if (std::addressof(node->data) == std::addressof(val)) {
+                        aliased = node;
+                    } else {
+                        unlinkRange(node, node, 1);
+                        destroyNode(node);
+                        removed++;
+                    }
+                }
+                node = next;
+            }
+            if (aliased != nullptr) {
+                unlinkRange(aliased, aliased, 1);
+                destroyNode(aliased);
+                removed++;
+            }
+            return removed;
+        }
+
+        void swap(List& other) noexcept {
+            this->cursor = nullptr;
+            other.cursor = nullptr;
+
             Node*tmpHead = this->head;
             this->head = other.head;
             other.head = tmpHead;
@@ -509,22 +1055,19 @@ namespace cont {
             this->tail = other.tail;
             other.tail = tmpTail;
 
-            Allocator tmpAllocator = this->allocator;
-            this->allocator = other.allocator;
-            other.allocator = tmpAllocator;
+            this->pool.swap(other.pool);
 
             std::size_t tmpSize = this->len;
             this->len = other.len;
             other.len = tmpSize;
         }
 
-        bool operator==(const MyContainer<T>& other) const override {
-            const auto *otherList = dynamic_cast<const List *>(&other);
-            if (this->len != otherList->len) {
+        bool operator==(const List& other) const {
+            if (this->len != other.len) {
                 return false;
             }
             auto it1 = this->begin();
-            auto it2 = otherList->begin();
+            auto it2 = other.begin();
             while (it1 != this->end()) {
                 if (*it1 != *it2) {
                     return false;
@@ -535,10 +1078,6 @@ namespace cont {
             return true;
         }
 
-        bool operator!=(const MyContainer<T>& other) const override {
-            return !(*this == other);
-        }
-
         std::strong_ordering operator<=>(const List& other) const {
             auto it1 = this->begin();
             auto it2 = other.begin();
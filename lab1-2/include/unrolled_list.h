@@ -0,0 +1,586 @@
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <cstddef>
+#include <compare>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include "list.h"
+
+namespace cont {
+    template<class T>
+    inline constexpr std::size_t UnrolledDefaultK = sizeof(T) < 64 ? 256 / sizeof(T) : 4;
+
+    // Same interface as List, but each node keeps up to K elements in a contiguous block,
+    // so traversal touches one cache line per several elements instead of one per element.
+    // Iterators and references to elements of untouched nodes stay valid across insert/erase.
+    template<class T, std::size_t K = UnrolledDefaultK<T>, class Allocator = std::allocator<T> >
+    class UnrolledList : public ContainerBase<UnrolledList<T, K, Allocator> > {
+        static_assert(K >= 2, "UnrolledList needs at least two elements per node");
+
+    private:
+        using noConstT = std::remove_const_t<T>;
+
+        struct Node {
+            Node *next;
+            Node *prev;
+            std::size_t count;
+            alignas(noConstT) unsigned char storage[K * sizeof(noConstT)];
+
+            noConstT *items() {
+                return reinterpret_cast<noConstT *>(storage);
+            }
+        };
+
+        NodePool<Node, Allocator> pool;
+
+        Node *head = nullptr;
+        Node *tail = nullptr;
+        std::size_t len = 0;
+
+        Node *createNode() {
+            Node *node = ::new(static_cast<void *>(pool.allocate())) Node;
+            node->next = nullptr;
+            node->prev = nullptr;
+            node->count = 0;
+            return node;
+        }
+
+        void linkAfter(Node *where, Node *node) {
+            node->prev = where;
+            if (where == nullptr) {
+                node->next = head;
+                if (head != nullptr) {
+                    head->prev = node;
+                }
+                head = node;
+            } else {
+                node->next = where->next;
+                if (where->next != nullptr) {
+                    where->next->prev = node;
+                }
+                where->next = node;
+            }
+            if (node->next == nullptr) {
+                tail = node;
+            }
+        }
+
+        void unlink(Node *node) noexcept {
+            if (node->prev != nullptr) {
+                node->prev->next = node->next;
+            } else {
+                head = node->next;
+            }
+            if (node->next != nullptr) {
+                node->next->prev = node->prev;
+            } else {
+                tail = node->prev;
+            }
+            pool.deallocate(node);
+        }
+
+        // Opens a gap at idx by moving [idx, count) one slot to the right.
+        static void shiftRight(Node *node, std::size_t idx) {
+            noConstT *items = node->items();
+            if (idx == node->count) {
+                return;
+            }
+            std::construct_at(items + node->count, std::move(items[node->count - 1]));
+            std::move_backward(items + idx, items + node->count - 1, items + node->count);
+            std::destroy_at(items + idx);
+        }
+
+        // Closes the hole left by an element already destroyed at idx.
+        static void shiftLeft(Node *node, std::size_t idx) {
+            noConstT *items = node->items();
+            for (std::size_t i = idx; i + 1 < node->count; i++) {
+                std::construct_at(items + i, std::move(items[i + 1]));
+                std::destroy_at(items + i + 1);
+            }
+        }
+
+        static void moveTail(Node *from, std::size_t idx, Node *to) {
+            noConstT *src = from->items();
+            noConstT *dst = to->items() + to->count;
+            for (std::size_t i = idx; i < from->count; i++) {
+                std::construct_at(dst++, std::move(src[i]));
+                std::destroy_at(src + i);
+            }
+            to->count += from->count - idx;
+            from->count = idx;
+        }
+
+        void emplaceAt(Node *node, std::size_t idx, noConstT val) {
+            if (node->count == K) {
+                // Split the full node in half so both stay dense.
+                Node *right = createNode();
+                linkAfter(node, right);
+                moveTail(node, K / 2, right);
+                if (idx > K / 2) {
+                    idx -= K / 2;
+                    node = right;
+                }
+            }
+            shiftRight(node, idx);
+            std::construct_at(node->items() + idx, std::move(val));
+            node->count++;
+            len++;
+        }
+
+        void deleteList() {
+            if constexpr (!std::is_trivially_destructible_v<noConstT>) {
+                for (Node *node = head; node != nullptr; node = node->next) {
+                    std::destroy_n(node->items(), node->count);
+                }
+            }
+            pool.release();
+            head = nullptr;
+            tail = nullptr;
+            len = 0;
+        }
+
+        void copyFrom(const UnrolledList &other) {
+            for (Node *node = other.head; node != nullptr; node = node->next) {
+                for (std::size_t i = 0; i < node->count; i++) {
+                    push_back(node->items()[i]);
+                }
+            }
+        }
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+
+        UnrolledList() = default;
+
+        explicit UnrolledList(const Allocator &alloc) : pool(alloc) {
+        }
+
+        UnrolledList(std::initializer_list<T> init) {
+            for (const T &val: init) {
+                push_back(val);
+            }
+        }
+
+        UnrolledList(const UnrolledList &other)
+            : pool(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+                other.pool.get_allocator())) {
+            copyFrom(other);
+        }
+
+        UnrolledList(UnrolledList &&other) noexcept : pool(std::move(other.pool)) {
+            head = other.head;
+            tail = other.tail;
+            len = other.len;
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.len = 0;
+        }
+
+        ~UnrolledList() {
+            deleteList();
+        }
+
+        UnrolledList &operator=(const UnrolledList &other) {
+            if (this != &other) {
+                deleteList();
+                if constexpr (std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value) {
+                    pool = NodePool<Node, Allocator>(other.pool.get_allocator());
+                }
+                copyFrom(other);
+            }
+            return *this;
+        }
+
+        UnrolledList &operator=(UnrolledList &&other) noexcept {
+            if (this != &other) {
+                deleteList();
+                pool = std::move(other.pool);
+                head = other.head;
+                tail = other.tail;
+                len = other.len;
+                other.head = nullptr;
+                other.tail = nullptr;
+                other.len = 0;
+            }
+            return *this;
+        }
+
+        T &front() {
+            if (head == nullptr) {
+                throw std::out_of_range("UnrolledList::front. List doesn't exist.");
+            }
+            return head->items()[0];
+        }
+
+        T &back() {
+            if (tail == nullptr) {
+                throw std::out_of_range("UnrolledList::back. List doesn't exist.");
+            }
+            return tail->items()[tail->count - 1];
+        }
+
+        template<class IterType>
+        class UnrolledIterator {
+        private:
+            friend class UnrolledList;
+            template<class>
+            friend class UnrolledIterator;
+            Node *node = nullptr;
+            std::size_t idx = 0;
+
+            UnrolledIterator(Node *node, std::size_t idx) : node(node), idx(idx) {
+            }
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = noConstT;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType *;
+            using reference = IterType &;
+
+            UnrolledIterator() = default;
+
+            UnrolledIterator(const UnrolledIterator &other) = default;
+
+            UnrolledIterator(UnrolledIterator &&other) = default;
+
+            template<class Other> requires std::is_convertible_v<Other *, IterType *>
+            UnrolledIterator(const UnrolledIterator<Other> &other) : node(other.node), idx(other.idx) {
+            }
+
+            UnrolledIterator &operator=(const UnrolledIterator &other) = default;
+
+            UnrolledIterator &operator=(UnrolledIterator &&other) = default;
+
+            UnrolledIterator &operator++() {
+                if (++idx == node->count) {
+                    node = node->next;
+                    idx = 0;
+                }
+                return *this;
+            }
+
+            UnrolledIterator &operator--() {
+                if (idx == 0) {
+                    node = node->prev;
+                    idx = node->count;
+                }
+                --idx;
+                return *this;
+            }
+
+            UnrolledIterator operator++(int) {
+                UnrolledIterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            UnrolledIterator operator--(int) {
+                UnrolledIterator tmp = *this;
+                --*this;
+                return tmp;
+            }
+
+            bool operator==(const UnrolledIterator &other) const {
+                return node == other.node && idx == other.idx;
+            }
+
+            bool operator!=(const UnrolledIterator &other) const {
+                return !(*this == other);
+            }
+
+            reference operator*() const {
+                return node->items()[idx];
+            }
+
+            pointer operator->() const {
+                return node->items() + idx;
+            }
+
+            // Skips whole nodes, so an offset of n costs about n / K hops.
+            UnrolledIterator &next(std::size_t offset = 1) {
+                while (offset > 0) {
+                    if (node == nullptr) {
+                        throw std::out_of_range("UnrolledIterator::next. Offset is out of the collection.");
+                    }
+                    std::size_t left = node->count - idx;
+                    if (offset < left) {
+                        idx += offset;
+                        return *this;
+                    }
+                    offset -= left;
+                    node = node->next;
+                    idx = 0;
+                }
+                return *this;
+            }
+        };
+
+        template<class IterType>
+        class ReverseUnrolledIterator {
+        private:
+            friend class UnrolledList;
+            template<class>
+            friend class ReverseUnrolledIterator;
+            Node *node = nullptr;
+            std::size_t idx = 0;
+
+            ReverseUnrolledIterator(Node *node, std::size_t idx) : node(node), idx(idx) {
+            }
+
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = noConstT;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType *;
+            using reference = IterType &;
+
+            ReverseUnrolledIterator() = default;
+
+            ReverseUnrolledIterator(const ReverseUnrolledIterator &other) = default;
+
+            ReverseUnrolledIterator(ReverseUnrolledIterator &&other) = default;
+
+            template<class Other> requires std::is_convertible_v<Other *, IterType *>
+            ReverseUnrolledIterator(const ReverseUnrolledIterator<Other> &other) : node(other.node), idx(other.idx) {
+            }
+
+            ReverseUnrolledIterator &operator=(const ReverseUnrolledIterator &other) = default;
+
+            ReverseUnrolledIterator &operator=(ReverseUnrolledIterator &&other) = default;
+
+            ReverseUnrolledIterator &operator++() {
+                if (idx == 0) {
+                    node = node->prev;
+                    idx = node != nullptr ? node->count - 1 : 0;
+                } else {
+                    --idx;
+                }
+                return *this;
+            }
+
+            ReverseUnrolledIterator &operator--() {
+                if (++idx == node->count) {
+                    node = node->next;
+                    idx = 0;
+                }
+                return *this;
+            }
+
+            ReverseUnrolledIterator operator++(int) {
+                ReverseUnrolledIterator tmp = *this;
+                ++*this;
+                return tmp;
+            }
+
+            ReverseUnrolledIterator operator--(int) {
+                ReverseUnrolledIterator tmp = *this;
+                --*this;
+                return tmp;
+            }
+
+            bool operator==(const ReverseUnrolledIterator &other) const {
+                return node == other.node && idx == other.idx;
+            }
+
+            bool operator!=(const ReverseUnrolledIterator &other) const {
+                return !(*this == other);
+            }
+
+            reference operator*() const {
+                return node->items()[idx];
+            }
+
+            pointer operator->() const {
+                return node->items() + idx;
+            }
+        };
+
+        using Iterator = UnrolledIterator<T>;
+        using ReverseIterator = ReverseUnrolledIterator<T>;
+        using ConstIterator = UnrolledIterator<const noConstT>;
+        using ConstReverseIterator = ReverseUnrolledIterator<const noConstT>;
+
+        Iterator begin() const {
+            return Iterator(head, 0);
+        }
+
+        Iterator end() const {
+            return Iterator(nullptr, 0);
+        }
+
+        ConstIterator cbegin() const {
+            return ConstIterator(head, 0);
+        }
+
+        ConstIterator cend() const {
+            return ConstIterator(nullptr, 0);
+        }
+
+        ReverseIterator rbegin() const {
+            return tail == nullptr ? rend() : ReverseIterator(tail, tail->count - 1);
+        }
+
+        ReverseIterator rend() const {
+            return ReverseIterator(nullptr, 0);
+        }
+
+        ConstReverseIterator crbegin() const {
+            return tail == nullptr ? crend() : ConstReverseIterator(tail, tail->count - 1);
+        }
+
+        ConstReverseIterator crend() const {
+            return ConstReverseIterator(nullptr, 0);
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return len;
+        }
+
+        [[nodiscard]] std::size_t max_size() const {
+            return std::allocator_traits<Allocator>::max_size(pool.get_allocator());
+        }
+
+        Allocator get_allocator() const {
+            return pool.get_allocator();
+        }
+
+        void clear() {
+            deleteList();
+        }
+
+        void insert(ConstIterator posIter, noConstT val) {
+            if (posIter.node == nullptr) {
+                push_back(std::move(val));
+                return;
+            }
+            emplaceAt(posIter.node, posIter.idx, std::move(val));
+        }
+
+        Iterator erase(ConstIterator posIter) {
+            if (posIter.node == nullptr) {
+                throw std::out_of_range("UnrolledIterator::erase. Offset is out of the collection.");
+            }
+            Node *node = posIter.node;
+            std::size_t idx = posIter.idx;
+            std::destroy_at(node->items() + idx);
+            shiftLeft(node, idx);
+            node->count--;
+            len--;
+            if (node->count == 0) {
+                Node *next = node->next;
+                unlink(node);
+                return Iterator(next, 0);
+            }
+            // Pull the successor in while both fit, so nodes stay at least half full.
+            Node *next = node->next;
+            if (next != nullptr && node->count < K / 2 && node->count + next->count <= K) {
+                moveTail(next, 0, node);
+                unlink(next);
+            }
+            if (idx < node->count) {
+                return Iterator(node, idx);
+            }
+            return Iterator(node->next, 0);
+        }
+
+        void push_back(noConstT val) {
+            if (tail == nullptr || tail->count == K) {
+                linkAfter(tail, createNode());
+            }
+            std::construct_at(tail->items() + tail->count, std::move(val));
+            tail->count++;
+            len++;
+        }
+
+        void pop_back() {
+            if (len == 0) {
+                throw std::out_of_range("UnrolledIterator::pop_back. Size is 0");
+            }
+            std::destroy_at(tail->items() + tail->count - 1);
+            tail->count--;
+            len--;
+            if (tail->count == 0) {
+                unlink(tail);
+            }
+        }
+
+        void push_front(noConstT val) {
+            if (head == nullptr || head->count == K) {
+                linkAfter(nullptr, createNode());
+            }
+            emplaceAt(head, 0, std::move(val));
+        }
+
+        void pop_front() {
+            if (len == 0) {
+                throw std::out_of_range("UnrolledIterator::pop_front. Size is 0");
+            }
+            std::destroy_at(head->items());
+            shiftLeft(head, 0);
+            head->count--;
+            len--;
+            if (head->count == 0) {
+                unlink(head);
+            }
+        }
+
+        void resize(std::size_t newSize, noConstT val) {
+            if (newSize <= 0) {
+                throw std::out_of_range("UnrolledIterator::resize. New size must be more than 0.");
+            }
+            while (len > newSize) {
+                pop_back();
+            }
+            while (len < newSize) {
+                push_back(val);
+            }
+        }
+
+        void swap(UnrolledList &other) noexcept {
+            std::swap(head, other.head);
+            std::swap(tail, other.tail);
+            std::swap(len, other.len);
+            pool.swap(other.pool);
+        }
+
+        bool operator==(const UnrolledList &other) const {
+            if (this->len != other.len) {
+                return false;
+            }
+            auto it1 = this->begin();
+            auto it2 = other.begin();
+            while (it1 != this->end()) {
+                if (*it1 != *it2) {
+                    return false;
+                }
+                ++it1;
+                ++it2;
+            }
+            return true;
+        }
+
+        std::strong_ordering operator<=>(const UnrolledList &other) const {
+            auto it1 = this->begin();
+            auto it2 = other.begin();
+
+            while (it1 != this->end() && it2 != other.end()) {
+                if (auto cmp = *it1 <=> *it2; cmp != 0) {
+                    return cmp;
+                }
+                ++it1;
+                ++it2;
+            }
+            return this->len <=> other.len;
+        }
+    };
+}
+
+#endif //UNROLLED_LIST_H
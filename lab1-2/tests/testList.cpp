@@ -1,5 +1,15 @@
 #include "list.h"
+#include "unrolled_list.h"
+#include "concurrent_list.h"
+#include "intrusive_list.h"
+#include "../../lab1-5/tests/counting_allocator.h"
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 //using namespace cont;
 
@@ -425,6 +435,609 @@ TEST(Swap, WithSelf) {
 //     EXPECT_EQ(l.size(), 3);
 // }
 
+TEST(Interface, StaticContainer) {
+    static_assert(cont::Container<cont::List<int> >);
+    static_assert(!std::is_polymorphic_v<cont::List<int> >);
+    cont::List<int> l;
+    EXPECT_TRUE(l.empty());
+    l.push_back(1);
+    EXPECT_FALSE(l.empty());
+}
+
+TEST(Interface, PolymorphicContainer) {
+    cont::PolymorphicContainer<cont::List<int> > a = {1, 2, 3};
+    cont::PolymorphicContainer<cont::List<int> > b = {1, 2, 3};
+    const cont::MyContainer<int> &base = b;
+    EXPECT_TRUE(a == base);
+    EXPECT_EQ(base.size(), 3);
+    b.push_back(4);
+    EXPECT_TRUE(a != base);
+    EXPECT_FALSE(base.empty());
+}
+
+TEST(Pool, UsesUserAllocator) {
+    AllocationStats stats;
+    {
+        cont::List<int, CountingAllocator<int> > l{CountingAllocator<int>(&stats)};
+        for (int i = 0; i < 1000; i++) {
+            l.push_back(i);
+        }
+        EXPECT_GT(stats.calls, 0);
+        EXPECT_LT(stats.calls, 20);
+        EXPECT_LT(stats.live, 1000 * 64);
+        EXPECT_EQ(l.front(), 0);
+        EXPECT_EQ(l.back(), 999);
+    }
+    EXPECT_EQ(stats.live, 0);
+}
+
+TEST(Pool, ReusesFreedNodes) {
+    AllocationStats stats;
+    cont::List<int, CountingAllocator<int> > l{CountingAllocator<int>(&stats)};
+    for (int i = 0; i < 10; i++) {
+        l.push_back(i);
+    }
+    std::size_t before = stats.calls;
+    for (int i = 0; i < 10000; i++) {
+        l.pop_front();
+        l.push_back(i);
+    }
+    EXPECT_EQ(stats.calls, before);
+    EXPECT_EQ(l.size(), 10);
+    EXPECT_EQ(l.back(), 9999);
+}
+
+TEST(Pool, NonTrivialElements) {
+    cont::List<std::string> l;
+    for (int i = 0; i < 100; i++) {
+        l.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+    }
+    l.pop_front();
+    l.pop_back();
+    l.erase(l.cbegin());
+    cont::List<std::string> copy = l;
+    EXPECT_EQ(copy, l);
+    EXPECT_EQ(copy.front(), std::string(40, 'c'));
+    cont::List<std::string> moved;
+    moved = std::move(copy);
+    EXPECT_EQ(moved.size(), 97);
+    l.clear();
+    l.push_back("x");
+    EXPECT_EQ(l.front(), "x");
+}
+
+TEST(Unrolled, PushPopAcrossNodes) {
+    cont::UnrolledList<int, 4> l;
+    for (int i = 0; i < 10; i++) {
+        l.push_back(i);
+    }
+    l.push_front(-1);
+    EXPECT_EQ(l.size(), 11);
+    EXPECT_EQ(l.front(), -1);
+    EXPECT_EQ(l.back(), 9);
+    l.pop_front();
+    l.pop_back();
+    int expected = 0;
+    for (int v: l) {
+        EXPECT_EQ(v, expected++);
+    }
+    EXPECT_EQ(expected, 9);
+    expected = 8;
+    for (auto it = l.crbegin(); it != l.crend(); ++it) {
+        EXPECT_EQ(*it, expected--);
+    }
+}
+
+TEST(Unrolled, InsertSplitsAndEraseMerges) {
+    cont::UnrolledList<int, 4> l = {0, 1, 2, 3};
+    l.insert(l.cbegin().next(2), 10);
+    l.insert(l.cbegin(), 11);
+    l.insert(l.cend(), 12);
+    cont::UnrolledList<int, 4> expected = {11, 0, 1, 10, 2, 3, 12};
+    EXPECT_EQ(l, expected);
+    auto it = l.erase(l.cbegin().next(3));
+    EXPECT_EQ(*it, 2);
+    it = l.erase(l.cbegin());
+    EXPECT_EQ(*it, 0);
+    while (l.size() > 1) {
+        l.erase(l.cbegin());
+    }
+    EXPECT_EQ(l.front(), 12);
+    EXPECT_EQ(l.erase(l.cbegin()), l.end());
+    EXPECT_TRUE(l.empty());
+}
+
+TEST(Unrolled, MatchesList) {
+    cont::List<int> ref;
+    cont::UnrolledList<int, 8> l;
+    for (int i = 0; i < 500; i++) {
+        ref.push_back(i);
+        l.push_back(i);
+    }
+    for (int i = 0; i < 200; i++) {
+        std::size_t pos = static_cast<std::size_t>(i * 7) % ref.size();
+        if (i % 3 == 0) {
+            ref.erase(ref.cbegin().next(pos));
+            l.erase(l.cbegin().next(pos));
+        } else {
+            ref.insert(ref.cbegin().next(pos), -i);
+            l.insert(l.cbegin().next(pos), -i);
+        }
+    }
+    ASSERT_EQ(ref.size(), l.size());
+    auto it = l.begin();
+    for (int v: ref) {
+        EXPECT_EQ(v, *it);
+        ++it;
+    }
+}
+
+TEST(Unrolled, CopyMoveAndCompare) {
+    cont::UnrolledList<std::string, 3> l;
+    for (int i = 0; i < 20; i++) {
+        l.push_back(std::string(30, static_cast<char>('a' + i)));
+    }
+    cont::UnrolledList<std::string, 3> copy = l;
+    EXPECT_EQ(copy, l);
+    copy.back() = "z";
+    EXPECT_TRUE(copy > l);
+    cont::UnrolledList<std::string, 3> moved = std::move(copy);
+    EXPECT_EQ(moved.size(), 20);
+    EXPECT_TRUE(copy.empty());
+    moved.swap(l);
+    EXPECT_EQ(l.back(), "z");
+    l.resize(5, "x");
+    EXPECT_EQ(l.size(), 5);
+    static_assert(cont::Container<cont::UnrolledList<int> >);
+}
+
+TEST(Splice, WholeList) {
+    cont::List<int> a = {1, 2, 3};
+    {
+        cont::List<int> b = {10, 20};
+        a.splice(a.cbegin().next(1), b);
+        EXPECT_TRUE(b.empty());
+        b.push_back(30);
+        a.splice(a.cend(), b);
+    }
+    cont::List<int> expected = {1, 10, 20, 2, 3, 30};
+    EXPECT_EQ(a, expected);
+    EXPECT_EQ(a.back(), 30);
+    a.pop_back();
+    a.push_back(40);
+    EXPECT_EQ(a.size(), 6);
+}
+
+TEST(Splice, SingleAndRange) {
+    cont::List<int> a = {1, 2, 3, 4, 5};
+    cont::List<int> b = {10, 20, 30, 40};
+    a.splice(a.cbegin(), b, b.cbegin().next(3));
+    a.splice(a.cend(), b, b.cbegin(), b.cbegin().next(2));
+    cont::List<int> expectedA = {40, 1, 2, 3, 4, 5, 10, 20};
+    cont::List<int> expectedB = {30};
+    EXPECT_EQ(a, expectedA);
+    EXPECT_EQ(b, expectedB);
+    a.splice(a.cbegin(), a, a.cbegin().next(3), a.cend());
+    cont::List<int> rotated = {3, 4, 5, 10, 20, 40, 1, 2};
+    EXPECT_EQ(a, rotated);
+    EXPECT_EQ(a.back(), 2);
+    b.splice(b.cend(), a, a.cbegin());
+    EXPECT_EQ(b.back(), 3);
+    EXPECT_EQ(a.size() + b.size(), 9);
+}
+
+TEST(Splice, SourceOutlivedByNodes) {
+    cont::List<std::string> a;
+    {
+        cont::List<std::string> b;
+        for (int i = 0; i < 100; i++) {
+            b.push_back(std::string(20, static_cast<char>('a' + i % 26)));
+        }
+        a.splice(a.cend(), b, b.cbegin().next(10), b.cend());
+    }
+    EXPECT_EQ(a.size(), 90);
+    EXPECT_EQ(a.front(), std::string(20, 'k'));
+    a.clear();
+    EXPECT_TRUE(a.empty());
+}
+
+TEST(Splice, ChainedPools) {
+    cont::List<int> c = {1, 2, 3};
+    cont::List<int> b = {4, 5, 6};
+    b.splice(b.cend(), c, c.cbegin());
+    {
+        cont::List<int> a = {7, 8};
+        a.splice(a.cend(), b, b.cbegin());
+        c.splice(c.cend(), a, a.cbegin());
+    }
+    c.push_back(9);
+    b.push_back(10);
+    cont::List<int> expectedC = {2, 3, 7, 9};
+    cont::List<int> expectedB = {5, 6, 1, 10};
+    EXPECT_EQ(c, expectedC);
+    EXPECT_EQ(b, expectedB);
+}
+
+TEST(Splice, SlabsFreedIndependently) {
+    AllocationStats stats;
+    CountingAllocator<int> alloc(&stats);
+    cont::List<int, CountingAllocator<int> > a(alloc);
+    std::size_t full = 0;
+    {
+        cont::List<int, CountingAllocator<int> > b(alloc);
+        for (int i = 0; i < 1000; i++) {
+            b.push_back(i);
+        }
+        full = stats.live;
+        a.splice(a.cend(), b, b.cbegin());
+    }
+    // Only the first slab of b stays, held by the one node a took over.
+    EXPECT_GT(stats.live, 0);
+    EXPECT_LT(stats.live, full / 10);
+    EXPECT_EQ(a.front(), 0);
+    a.clear();
+    EXPECT_EQ(stats.live, 0);
+}
+
+TEST(Splice, ListsStayIndependentAcrossThreads) {
+    cont::List<std::string> a;
+    cont::List<std::string> b;
+    for (int i = 0; i < 200; i++) {
+        a.push_back(std::to_string(i));
+        b.push_back(std::to_string(-i));
+    }
+    a.splice(a.cend(), b, b.cbegin(), b.cbegin().next(100));
+    b.splice(b.cend(), a, a.cbegin(), a.cbegin().next(100));
+    auto churn = [](cont::List<std::string> &l) {
+        for (int i = 0; i < 20'000; i++) {
+            l.push_back(std::to_string(i));
+            l.pop_front();
+        }
+    };
+    std::thread other([&] { churn(b); });
+    churn(a);
+    other.join();
+    EXPECT_EQ(a.size(), 200);
+    EXPECT_EQ(b.size(), 200);
+    EXPECT_EQ(a.back(), "19999");
+    EXPECT_EQ(b.back(), "19999");
+}
+
+TEST(Merge, Stable) {
+    cont::List<std::pair<int, int> > a = {{1, 0}, {3, 0}, {5, 0}};
+    cont::List<std::pair<int, int> > b = {{1, 1}, {2, 1}, {5, 1}, {6, 1}};
+    auto byKey = [](const auto &x, const auto &y) { return x.first < y.first; };
+    a.merge(b, byKey);
+    cont::List<std::pair<int, int> > expected = {{1, 0}, {1, 1}, {2, 1}, {3, 0}, {5, 0}, {5, 1}, {6, 1}};
+    EXPECT_EQ(a, expected);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a.back().first, 6);
+}
+
+TEST(Sort, StableAndLinked) {
+    cont::List<std::pair<int, int> > l;
+    for (int i = 0; i < 1000; i++) {
+        l.push_back({(i * 37) % 11, i});
+    }
+    l.sort([](const auto &x, const auto &y) { return x.first < y.first; });
+    EXPECT_EQ(l.size(), 1000);
+    auto prev = l.front();
+    for (auto it = ++l.begin(); it != l.end(); ++it) {
+        EXPECT_TRUE(prev.first < (*it).first || (prev.first == (*it).first && prev.second < (*it).second));
+        prev = *it;
+    }
+    std::size_t back = 0;
+    for (auto it = l.rbegin(); it != l.rend(); ++it) {
+        back++;
+    }
+    EXPECT_EQ(back, 1000);
+    cont::List<int> ints = {5, 1, 4, 2, 3};
+    ints.sort();
+    cont::List<int> sorted = {1, 2, 3, 4, 5};
+    EXPECT_EQ(ints, sorted);
+}
+
+TEST(Unique, AndRemoveIf) {
+    cont::List<int> l = {1, 1, 2, 2, 2, 3, 1, 1};
+    EXPECT_EQ(l.unique(), 4);
+    cont::List<int> expected = {1, 2, 3, 1};
+    EXPECT_EQ(l, expected);
+    EXPECT_EQ(l.remove_if([](int v) { return v == 1; }), 2);
+    cont::List<int> rest = {2, 3};
+    EXPECT_EQ(l, rest);
+    EXPECT_EQ(l.remove(3), 1);
+    EXPECT_EQ(l.back(), 2);
+    EXPECT_EQ(l.remove(2), 1);
+    EXPECT_TRUE(l.empty());
+
+    cont::List<std::string> words = {"x", "y", "x", "z", "x"};
+    EXPECT_EQ(words.remove(*words.cbegin().next(2)), 3);
+    cont::List<std::string> left = {"y", "z"};
+    EXPECT_EQ(words, left);
+}
+
+struct CopyCounter {
+    static inline int copies = 0;
+    static inline int moves = 0;
+    int value;
+
+    explicit CopyCounter(int value) : value(value) {
+    }
+
+    CopyCounter(const CopyCounter &other) : value(other.value) {
+        copies++;
+    }
+
+    CopyCounter(CopyCounter &&other) noexcept : value(other.value) {
+        moves++;
+    }
+
+    CopyCounter &operator=(const CopyCounter &other) {
+        value = other.value;
+        copies++;
+        return *this;
+    }
+
+    CopyCounter &operator=(CopyCounter &&other) noexcept {
+        value = other.value;
+        moves++;
+        return *this;
+    }
+};
+
+TEST(Emplace, ConstructsInPlace) {
+    CopyCounter::copies = 0;
+    CopyCounter::moves = 0;
+    cont::List<CopyCounter> l;
+    l.emplace_back(2);
+    l.emplace_front(1);
+    auto it = l.emplace(l.cend(), 4);
+    EXPECT_EQ((*it).value, 4);
+    l.emplace(l.cbegin().next(2), 3);
+    EXPECT_EQ(CopyCounter::copies, 0);
+    EXPECT_EQ(CopyCounter::moves, 0);
+    int expected = 1;
+    for (const auto &c: l) {
+        EXPECT_EQ(c.value, expected++);
+    }
+    EXPECT_EQ(l.emplace_back(5).value, 5);
+}
+
+TEST(Emplace, RvalueOverloadsMove) {
+    CopyCounter::copies = 0;
+    CopyCounter::moves = 0;
+    cont::List<CopyCounter> l;
+    l.push_back(CopyCounter(1));
+    l.push_front(CopyCounter(0));
+    l.insert(l.cend(), CopyCounter(2));
+    EXPECT_EQ(CopyCounter::copies, 0);
+    EXPECT_EQ(CopyCounter::moves, 3);
+    CopyCounter c(3);
+    l.push_back(c);
+    EXPECT_EQ(CopyCounter::copies, 1);
+    EXPECT_EQ(l.size(), 4);
+}
+
+TEST(Emplace, MoveOnlyElements) {
+    cont::List<std::unique_ptr<int> > l;
+    l.push_back(std::make_unique<int>(1));
+    l.emplace_back(new int(2));
+    l.emplace_front(std::make_unique<int>(0));
+    EXPECT_EQ(*l.front(), 0);
+    EXPECT_EQ(*l.back(), 2);
+    l.pop_front();
+    EXPECT_EQ(*l.front(), 1);
+}
+
+TEST(Emplace, CopyAssignReusesNodes) {
+    CopyCounter::copies = 0;
+    cont::List<CopyCounter> a;
+    cont::List<CopyCounter> b;
+    for (int i = 0; i < 5; i++) {
+        a.emplace_back(i);
+    }
+    for (int i = 0; i < 3; i++) {
+        b.emplace_back(10 + i);
+    }
+    a = b;
+    EXPECT_EQ(a.size(), 3);
+    EXPECT_EQ(a.back().value, 12);
+    EXPECT_EQ(CopyCounter::copies, 3);
+    b.emplace_back(13);
+    b.emplace_back(14);
+    a = b;
+    EXPECT_EQ(a.size(), 5);
+    EXPECT_EQ(a.back().value, 14);
+    cont::List<CopyCounter> c = a;
+    EXPECT_EQ(c.size(), 5);
+}
+
+TEST(Concurrent, SingleThreadFifo) {
+    cont::ConcurrentList<std::string> q;
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.pop_front().has_value());
+    q.push_back("a");
+    std::string b = "b";
+    q.push_back(b);
+    q.emplace_back(3, 'c');
+    EXPECT_FALSE(q.empty());
+    EXPECT_EQ(q.pop_front(), "a");
+    std::string out;
+    EXPECT_TRUE(q.try_pop_front(out));
+    EXPECT_EQ(out, "b");
+    EXPECT_EQ(q.pop_front(), "ccc");
+    EXPECT_TRUE(q.empty());
+    q.push_back("left for the destructor");
+}
+
+TEST(Concurrent, MoveOnly) {
+    cont::ConcurrentList<std::unique_ptr<int> > q;
+    q.push_back(std::make_unique<int>(7));
+    auto val = q.pop_front();
+    ASSERT_TRUE(val.has_value());
+    EXPECT_EQ(**val, 7);
+}
+
+TEST(Concurrent, ProducersAndConsumers) {
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int perProducer = 20000;
+    cont::ConcurrentList<int> q;
+    std::atomic<long long> sum{0};
+    std::atomic<int> popped{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&q, p] {
+            for (int i = 0; i < perProducer; i++) {
+                q.push_back(p * perProducer + i);
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&] {
+            int last[producers];
+            std::fill(std::begin(last), std::end(last), -1);
+            while (popped.load() < producers * perProducer) {
+                int val;
+                if (q.try_pop_front(val)) {
+                    // Values from one producer must come out in the order they went in.
+                    EXPECT_GT(val % perProducer, last[val / perProducer]);
+                    last[val / perProducer] = val % perProducer;
+                    sum += val;
+                    popped++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto &t: threads) {
+        t.join();
+    }
+    long long n = static_cast<long long>(producers) * perProducer;
+    EXPECT_EQ(sum.load(), n * (n - 1) / 2);
+    EXPECT_TRUE(q.empty());
+}
+
+struct Session {
+    int id;
+    cont::ListHook hook;
+    cont::ListHook lruHook;
+
+    explicit Session(int id) : id(id) {
+    }
+
+    bool operator==(const Session &other) const {
+        return id == other.id;
+    }
+
+    std::strong_ordering operator<=>(const Session &other) const {
+        return id <=> other.id;
+    }
+};
+
+using SessionList = cont::IntrusiveList<Session, &Session::hook>;
+using LruList = cont::IntrusiveList<Session, &Session::lruHook>;
+
+TEST(Intrusive, LinksWithoutCopying) {
+    Session a(1);
+    Session b(2);
+    Session c(3);
+    SessionList l;
+    l.push_back(b);
+    l.push_front(a);
+    l.insert(l.cend(), c);
+    EXPECT_EQ(l.size(), 3);
+    EXPECT_EQ(&l.front(), &a);
+    EXPECT_EQ(&l.back(), &c);
+    int expected = 1;
+    for (Session &s: l) {
+        EXPECT_EQ(s.id, expected++);
+    }
+    expected = 3;
+    for (auto it = l.crbegin(); it != l.crend(); ++it) {
+        EXPECT_EQ(it->id, expected--);
+    }
+    EXPECT_THROW(l.push_back(a), std::invalid_argument);
+}
+
+TEST(Intrusive, EraseByReference) {
+    std::vector<Session> sessions;
+    for (int i = 0; i < 5; i++) {
+        sessions.emplace_back(i);
+    }
+    SessionList all;
+    LruList lru;
+    for (Session &s: sessions) {
+        all.push_back(s);
+        lru.push_front(s);
+    }
+    all.erase(sessions[2]);
+    EXPECT_FALSE(sessions[2].hook.is_linked());
+    EXPECT_TRUE(sessions[2].lruHook.is_linked());
+    EXPECT_EQ(all.size(), 4);
+    EXPECT_EQ(lru.size(), 5);
+    auto it = all.erase(all.iterator_to(sessions[3]));
+    EXPECT_EQ(it->id, 4);
+    lru.pop_back();
+    EXPECT_EQ(lru.back().id, 1);
+    EXPECT_THROW(all.erase(sessions[2]), std::invalid_argument);
+    all.clear();
+    lru.clear();
+    EXPECT_FALSE(sessions[0].hook.is_linked());
+}
+
+TEST(Intrusive, MoveSwapCompare) {
+    Session a(1);
+    Session b(2);
+    Session c(1);
+    SessionList x;
+    x.push_back(a);
+    x.push_back(b);
+    SessionList y = std::move(x);
+    EXPECT_TRUE(x.empty());
+    EXPECT_EQ(y.size(), 2);
+    x.push_back(c);
+    x.swap(y);
+    EXPECT_EQ(x.size(), 2);
+    EXPECT_EQ(&y.front(), &c);
+    EXPECT_TRUE(y < x);
+    Session copy = a;
+    EXPECT_FALSE(copy.hook.is_linked());
+    static_assert(cont::Container<SessionList>);
+}
+
+TEST(PositionCache, MatchesIteration) {
+    cont::List<int> l;
+    for (int i = 0; i < 100; i++) {
+        l.push_back(i);
+    }
+    for (std::size_t i = 0; i < l.size(); i++) {
+        EXPECT_EQ(l[i], static_cast<int>(i));
+    }
+    for (std::size_t i = l.size(); i-- > 0;) {
+        EXPECT_EQ(l.at(i), static_cast<int>(i));
+    }
+    EXPECT_EQ(l.at(50), 50);
+    l.push_front(-1);
+    EXPECT_EQ(l.at(51), 50);
+    l.pop_front();
+    l.pop_front();
+    EXPECT_EQ(l.at(49), 50);
+    l.erase(l.cbegin().next(10));
+    EXPECT_EQ(l.at(49), 51);
+    l.insert(l.cbegin().next(5), 1000);
+    EXPECT_EQ(l.at(5), 1000);
+    EXPECT_EQ(l.at(50), 51);
+    while (l.size() > 51) {
+        l.pop_back();
+    }
+    EXPECT_EQ(l.at(50), 51);
+    l.sort([](int a, int b) { return a > b; });
+    EXPECT_EQ(l.at(0), 1000);
+    EXPECT_THROW(l.at(l.size()), std::out_of_range);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,49 @@
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <string>
+#include "deque.h"
+
+template<class Dq>
+void run(const char *name, std::size_t count) {
+    long long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    Dq deque;
+    for (std::size_t i = 0; i < count; i++) {
+        if (i % 2 == 0) {
+            deque.push_back(static_cast<int>(i));
+        } else {
+            deque.push_front(static_cast<int>(i));
+        }
+    }
+    auto pushed = std::chrono::steady_clock::now();
+    std::size_t stride = count / 7 + 1;
+    for (std::size_t i = 0, pos = 0; i < count; i++, pos = (pos + stride) % count) {
+        sum += deque[pos];
+    }
+    auto indexed = std::chrono::steady_clock::now();
+    for (int x: deque) {
+        sum += x;
+    }
+    auto iterated = std::chrono::steady_clock::now();
+    while (deque.size() > 1) {
+        deque.pop_front();
+        deque.pop_back();
+    }
+    auto popped = std::chrono::steady_clock::now();
+
+    std::cout << name << " N=" << count
+            << " push both ends: " << std::chrono::duration<double, std::milli>(pushed - start).count() << " ms"
+            << ", strided []: " << std::chrono::duration<double, std::milli>(indexed - pushed).count() << " ms"
+            << ", iterate: " << std::chrono::duration<double, std::milli>(iterated - indexed).count() << " ms"
+            << ", pop both ends: " << std::chrono::duration<double, std::milli>(popped - iterated).count() << " ms"
+            << " (" << sum << ")" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 1'000'000;
+    run<contDQ::Deque<int> >("contDQ::Deque", count);
+    run<std::deque<int> >("std::deque   ", count);
+    return 0;
+}
@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "deque.h"
+#include "work_stealing_deque.h"
+
+// A small fork-join thread pool. Each worker owns a WorkStealingDeque of tasks: it pushes the
+// tasks it spawns and pops them back LIFO, and an idle worker steals the oldest task of a random
+// victim. Tasks submitted from outside the pool go through a mutex-guarded Deque. With
+// Stealing = false every task goes through that shared queue, which is the baseline.
+template<bool Stealing>
+class ForkJoinPool {
+private:
+    struct Task {
+        std::function<void()> fn;
+        std::atomic<int> *pending;
+    };
+
+    struct Worker {
+        contDQ::WorkStealingDeque<Task *> deque;
+        std::minstd_rand rng;
+    };
+
+    std::vector<std::unique_ptr<Worker> > workers;
+    std::vector<std::thread> threads;
+    std::mutex sharedMutex;
+    contDQ::Deque<Task *> shared;
+    std::atomic<bool> stop{false};
+
+    static thread_local Worker *self;
+
+    Task *takeShared() {
+        std::lock_guard lock(sharedMutex);
+        if (shared.empty()) {
+            return nullptr;
+        }
+        Task *task = shared.front();
+        shared.pop_front();
+        return task;
+    }
+
+    Task *findTask() {
+        if constexpr (Stealing) {
+            if (self != nullptr) {
+                if (auto task = self->deque.pop()) {
+                    return *task;
+                }
+                std::size_t n = workers.size();
+                std::size_t first = self->rng() % n;
+                for (std::size_t i = 0; i < n; i++) {
+                    Worker *victim = workers[(first + i) % n].get();
+                    if (victim == self) {
+                        continue;
+                    }
+                    if (auto task = victim->deque.steal()) {
+                        return *task;
+                    }
+                }
+            }
+        }
+        return takeShared();
+    }
+
+    static void run(Task *task) {
+        task->fn();
+        task->pending->fetch_sub(1, std::memory_order_release);
+        delete task;
+    }
+
+    // Runs one queued task, if there is any.
+    bool runOne() {
+        if (Task *task = findTask()) {
+            run(task);
+            return true;
+        }
+        return false;
+    }
+
+public:
+    explicit ForkJoinPool(std::size_t threadCount) {
+        for (std::size_t i = 0; i < threadCount; i++) {
+            workers.push_back(std::make_unique<Worker>());
+            workers.back()->rng.seed(static_cast<unsigned>(i + 1));
+        }
+        for (std::size_t i = 0; i < threadCount; i++) {
+            threads.emplace_back([this, i] {
+                self = workers[i].get();
+                while (!stop.load(std::memory_order_relaxed)) {
+                    if (!runOne()) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+    }
+
+    ForkJoinPool(const ForkJoinPool &other) = delete;
+
+    ~ForkJoinPool() {
+        stop.store(true);
+        for (auto &t: threads) {
+            t.join();
+        }
+    }
+
+    ForkJoinPool &operator=(const ForkJoinPool &other) = delete;
+
+    // Queues fn; pending is incremented now and decremented once fn has run.
+    void spawn(std::function<void()> fn, std::atomic<int> &pending) {
+        pending.fetch_add(1, std::memory_order_relaxed);
+        Task *task = new Task{std::move(fn), &pending};
+        if constexpr (Stealing) {
+            if (self != nullptr) {
+                self->deque.push(task);
+                return;
+            }
+        }
+        std::lock_guard lock(sharedMutex);
+        shared.push_back(task);
+    }
+
+    // Helps with other work until every task counted by pending has finished.
+    void wait(std::atomic<int> &pending) {
+        while (pending.load(std::memory_order_acquire) != 0) {
+            if (self == nullptr || !runOne()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+};
+
+template<bool Stealing>
+thread_local typename ForkJoinPool<Stealing>::Worker *ForkJoinPool<Stealing>::self = nullptr;
+
+long long fibSequential(int n) {
+    return n < 2 ? n : fibSequential(n - 1) + fibSequential(n - 2);
+}
+
+template<class Pool>
+long long fib(Pool &pool, int n, int cutoff) {
+    if (n <= cutoff) {
+        return fibSequential(n);
+    }
+    long long left = 0;
+    std::atomic<int> pending{0};
+    pool.spawn([&] { left = fib(pool, n - 1, cutoff); }, pending);
+    long long right = fib(pool, n - 2, cutoff);
+    pool.wait(pending);
+    return left + right;
+}
+
+template<bool Stealing>
+void runPool(const char *name, std::size_t threadCount, int n, int cutoff) {
+    ForkJoinPool<Stealing> pool(threadCount);
+    long long result = 0;
+    std::atomic<int> pending{0};
+    auto start = std::chrono::steady_clock::now();
+    pool.spawn([&] { result = fib(pool, n, cutoff); }, pending);
+    pool.wait(pending);
+    auto end = std::chrono::steady_clock::now();
+    std::cout << name << " threads=" << threadCount << " fib(" << n << ") cutoff=" << cutoff << ": "
+            << std::chrono::duration<double, std::milli>(end - start).count() << " ms (" << result << ")"
+            << std::endl;
+}
+
+int main(int argc, char **argv) {
+    int n = argc > 1 ? std::stoi(argv[1]) : 32;
+    int cutoff = argc > 2 ? std::stoi(argv[2]) : 12;
+    std::size_t threadCount = argc > 3 ? std::stoull(argv[3]) : std::max(1u, std::thread::hardware_concurrency());
+
+    auto start = std::chrono::steady_clock::now();
+    long long result = fibSequential(n);
+    auto end = std::chrono::steady_clock::now();
+    std::cout << "sequential          fib(" << n << "): "
+            << std::chrono::duration<double, std::milli>(end - start).count() << " ms (" << result << ")"
+            << std::endl;
+
+    runPool<false>("shared mutex queue ", threadCount, n, cutoff);
+    runPool<true>("work stealing      ", threadCount, n, cutoff);
+    return 0;
+}
@@ -0,0 +1,36 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include "deque.h"
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100'000;
+    contDQ::Deque<int> deque;
+    for (std::size_t i = 0; i < count; i++) {
+        deque.push_back(static_cast<int>(i));
+    }
+
+    long long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < deque.size(); i++) {
+        sum += deque[i];
+    }
+    auto forward = std::chrono::steady_clock::now();
+    for (std::size_t i = deque.size(); i-- > 0;) {
+        sum += deque.at(i);
+    }
+    auto backward = std::chrono::steady_clock::now();
+    std::size_t stride = count / 7 + 1;
+    for (std::size_t i = 0, pos = 0; i < count; i++, pos = (pos + stride) % count) {
+        sum += deque.at(pos);
+    }
+    auto strided = std::chrono::steady_clock::now();
+
+    std::cout << "N=" << count
+            << " operator[] forward: " << std::chrono::duration<double, std::milli>(forward - start).count() << " ms"
+            << ", at() backward: " << std::chrono::duration<double, std::milli>(backward - forward).count() << " ms"
+            << ", at() strided: " << std::chrono::duration<double, std::milli>(strided - backward).count() << " ms"
+            << " (" << sum << ")" << std::endl;
+    return 0;
+}
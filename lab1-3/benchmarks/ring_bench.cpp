@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "deque.h"
+#include "ring_deque.h"
+
+// The baseline the ring replaces: a Deque guarded by a mutex.
+class LockedDeque {
+private:
+    std::mutex mutex;
+    contDQ::Deque<long long> deque;
+
+public:
+    bool try_push_back(long long val) {
+        std::lock_guard lock(mutex);
+        deque.push_back(val);
+        return true;
+    }
+
+    bool try_pop_front(long long &out) {
+        std::lock_guard lock(mutex);
+        if (deque.empty()) {
+            return false;
+        }
+        out = deque.front();
+        deque.pop_front();
+        return true;
+    }
+
+    template<class InputIt>
+    std::size_t push_n(InputIt first, std::size_t n) {
+        std::lock_guard lock(mutex);
+        for (std::size_t i = 0; i < n; i++, ++first) {
+            deque.push_back(*first);
+        }
+        return n;
+    }
+
+    template<class OutputIt>
+    std::size_t pop_n(OutputIt out, std::size_t n) {
+        std::lock_guard lock(mutex);
+        std::size_t count = 0;
+        for (; count < n && !deque.empty(); count++, ++out) {
+            *out = deque.front();
+            deque.pop_front();
+        }
+        return count;
+    }
+};
+
+constexpr std::size_t Batch = 32;
+
+template<class Queue>
+void throughput(const char *name, int producers, int consumers, std::size_t perProducer, bool batched) {
+    Queue queue;
+    std::atomic<std::size_t> consumed{0};
+    std::atomic<long long> sum{0};
+    std::size_t total = perProducer * producers;
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&] {
+            long long buf[Batch];
+            for (std::size_t i = 0; i < perProducer;) {
+                if (batched) {
+                    std::size_t k = std::min(Batch, perProducer - i);
+                    for (std::size_t j = 0; j < k; j++) {
+                        buf[j] = static_cast<long long>(i + j);
+                    }
+                    std::size_t pushed = queue.push_n(buf, k);
+                    i += pushed;
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                } else if (queue.try_push_back(static_cast<long long>(i))) {
+                    i++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&] {
+            long long buf[Batch];
+            long long local = 0;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                std::size_t got = 0;
+                if (batched) {
+                    got = queue.pop_n(buf, Batch);
+                    for (std::size_t j = 0; j < got; j++) {
+                        local += buf[j];
+                    }
+                } else if (queue.try_pop_front(buf[0])) {
+                    local += buf[0];
+                    got = 1;
+                }
+                if (got == 0) {
+                    std::this_thread::yield();
+                } else {
+                    consumed.fetch_add(got, std::memory_order_relaxed);
+                }
+            }
+            sum.fetch_add(local);
+        });
+    }
+    for (auto &t: threads) {
+        t.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    std::cout << name << " " << producers << "P" << consumers << "C" << (batched ? " batch" : "      ")
+            << ": " << ms << " ms, " << static_cast<double>(total) / ms / 1000.0 << " Mitems/s"
+            << " (" << sum.load() << ")" << std::endl;
+}
+
+// Round trip of a single item through two queues between two threads.
+template<class Queue>
+void latency(const char *name, std::size_t rounds) {
+    Queue ping;
+    Queue pong;
+    std::thread echo([&] {
+        long long val;
+        for (std::size_t i = 0; i < rounds; i++) {
+            while (!ping.try_pop_front(val)) {
+                std::this_thread::yield();
+            }
+            while (!pong.try_push_back(val)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    auto start = std::chrono::steady_clock::now();
+    long long val;
+    for (std::size_t i = 0; i < rounds; i++) {
+        while (!ping.try_push_back(static_cast<long long>(i))) {
+            std::this_thread::yield();
+        }
+        while (!pong.try_pop_front(val)) {
+            std::this_thread::yield();
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    echo.join();
+    std::cout << name << " round trip: "
+            << std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(rounds)
+            << " ns" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 2'000'000;
+    using Spsc = contDQ::RingDeque<long long, 1024, contDQ::RingMode::SPSC>;
+    using Mpmc = contDQ::RingDeque<long long, 1024, contDQ::RingMode::MPMC>;
+
+    throughput<LockedDeque>("mutex+Deque", 1, 1, count, false);
+    throughput<LockedDeque>("mutex+Deque", 1, 1, count, true);
+    throughput<Spsc>("Ring SPSC  ", 1, 1, count, false);
+    throughput<Spsc>("Ring SPSC  ", 1, 1, count, true);
+    throughput<Mpmc>("Ring MPMC  ", 1, 1, count, false);
+    throughput<Mpmc>("Ring MPMC  ", 1, 1, count, true);
+    throughput<LockedDeque>("mutex+Deque", 4, 4, count / 4, false);
+    throughput<Mpmc>("Ring MPMC  ", 4, 4, count / 4, false);
+    throughput<Mpmc>("Ring MPMC  ", 4, 4, count / 4, true);
+
+    std::size_t rounds = count / 10;
+    latency<LockedDeque>("mutex+Deque", rounds);
+    latency<Spsc>("Ring SPSC  ", rounds);
+    latency<Mpmc>("Ring MPMC  ", rounds);
+    return 0;
+}
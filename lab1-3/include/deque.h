@@ -2,172 +2,544 @@
 #define DEQUE_H
 
 #include "../../lab1-2/include/list.h"
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
 
 namespace contDQ {
+    // Block deque: elements live in fixed-size chunks reached through a map of chunk pointers.
+    // Element i sits at map[(start + i) / BlockSize][(start + i) % BlockSize].
     template<class T, class Allocator = std::allocator<T> >
-    class Deque : public cont::List<T, Allocator> {
+    class Deque : public cont::ContainerBase<Deque<T, Allocator> > {
+    public:
+        static constexpr std::size_t BlockSize =
+                std::bit_floor(sizeof(T) <= 256 ? std::size_t{4096} / sizeof(T) : std::size_t{16});
+
     private:
-        cont::List<T, Allocator> list;
+        using AllocTraits = std::allocator_traits<Allocator>;
+        using MapAllocator = AllocTraits::template rebind_alloc<T *>;
+        using MapTraits = std::allocator_traits<MapAllocator>;
+
+        static constexpr std::size_t BlockShift = std::countr_zero(BlockSize);
+        static constexpr std::size_t BlockMask = BlockSize - 1;
+        static constexpr std::size_t MinMapSize = 8;
+
+        [[no_unique_address]] Allocator allocator;
+        T **map = nullptr;
+        std::size_t mapSize = 0;
+        std::size_t start = 0;
+        std::size_t len = 0;
+
+        T &slot(std::size_t pos) const {
+            std::size_t abs = start + pos;
+            return map[abs >> BlockShift][abs & BlockMask];
+        }
+
+        // Makes room in the map by re-centring the used blocks, or by doubling the map.
+        // Spare blocks travel with the rotation, so nothing is freed or reallocated here.
+        void reorganize() {
+            std::size_t firstBlock = start >> BlockShift;
+            std::size_t usedBlocks = len == 0 ? 0 : ((start + len - 1) >> BlockShift) - firstBlock + 1;
+            if (map != nullptr && (usedBlocks + 2) * 2 <= mapSize) {
+                std::size_t newFirst = (mapSize - usedBlocks) / 2;
+                if (newFirst > firstBlock) {
+                    std::rotate(map, map + mapSize - (newFirst - firstBlock), map + mapSize);
+                } else {
+                    std::rotate(map, map + (firstBlock - newFirst), map + mapSize);
+                }
+                start = (newFirst << BlockShift) + (start & BlockMask);
+                return;
+            }
+            std::size_t newSize = std::max(MinMapSize, mapSize * 2);
+            MapAllocator mapAllocator(allocator);
+            T **newMap = MapTraits::allocate(mapAllocator, newSize);
+            std::fill(newMap, newMap + newSize, nullptr);
+            std::size_t newFirst = (newSize - usedBlocks) / 2;
+            for (std::size_t i = 0; i < mapSize; i++) {
+                newMap[(i + newSize + newFirst - firstBlock) % newSize] = map[i];
+            }
+            if (map != nullptr) {
+                MapTraits::deallocate(mapAllocator, map, mapSize);
+            }
+            map = newMap;
+            mapSize = newSize;
+            start = (newFirst << BlockShift) + (start & BlockMask);
+        }
+
+        void ensureBlock(std::size_t block) {
+            if (map[block] == nullptr) {
+                map[block] = AllocTraits::allocate(allocator, BlockSize);
+            }
+        }
+
+        void reserveBack() {
+            if (map == nullptr || ((start + len) >> BlockShift) >= mapSize) {
+                reorganize();
+            }
+            ensureBlock((start + len) >> BlockShift);
+        }
+
+        void reserveFront() {
+            if (map == nullptr || start == 0) {
+                reorganize();
+            }
+            ensureBlock((start - 1) >> BlockShift);
+        }
+
+        void destroyAll() noexcept {
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for_each_segment([](T *first, T *last) {
+                    std::destroy(first, last);
+                });
+            }
+            len = 0;
+        }
+
+        void release() noexcept {
+            destroyAll();
+            for (std::size_t i = 0; i < mapSize; i++) {
+                if (map[i] != nullptr) {
+                    AllocTraits::deallocate(allocator, map[i], BlockSize);
+                }
+            }
+            if (map != nullptr) {
+                MapAllocator mapAllocator(allocator);
+                MapTraits::deallocate(mapAllocator, map, mapSize);
+            }
+            map = nullptr;
+            mapSize = 0;
+            start = 0;
+        }
+
+        void copyFrom(const Deque &other) {
+            other.for_each_segment([this](const T *first, const T *last) {
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+            });
+        }
+
+        // Takes over other's map and chunks; other is left empty with no storage.
+        void steal(Deque &other) noexcept {
+            map = std::exchange(other.map, nullptr);
+            mapSize = std::exchange(other.mapSize, 0);
+            start = std::exchange(other.start, 0);
+            len = std::exchange(other.len, 0);
+        }
 
     public:
-        Deque() {
-            list = cont::List<T, Allocator>();
+        using value_type = T;
+        using allocator_type = Allocator;
+
+        template<class IterType>
+        class DequeIterator {
+        private:
+            friend class Deque;
+            template<class>
+            friend class DequeIterator;
+            const Deque *owner = nullptr;
+            std::ptrdiff_t idx = 0;
+
+            DequeIterator(const Deque *owner, std::ptrdiff_t idx) : owner(owner), idx(idx) {
+            }
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = IterType *;
+            using reference = IterType &;
+
+            DequeIterator() = default;
+
+            DequeIterator(const DequeIterator &other) = default;
+
+            DequeIterator(DequeIterator &&other) = default;
+
+            template<class Other> requires std::is_convertible_v<Other *, IterType *>
+            DequeIterator(const DequeIterator<Other> &other) : owner(other.owner), idx(other.idx) {
+            }
+
+            DequeIterator &operator=(const DequeIterator &other) = default;
+
+            DequeIterator &operator=(DequeIterator &&other) = default;
+
+            DequeIterator &operator++() {
+                ++idx;
+                return *this;
+            }
+
+            DequeIterator &operator--() {
+                --idx;
+                return *this;
+            }
+
+            DequeIterator operator++(int) {
+                DequeIterator tmp = *this;
+                ++idx;
+                return tmp;
+            }
+
+            DequeIterator operator--(int) {
+                DequeIterator tmp = *this;
+                --idx;
+                return tmp;
+            }
+
+            DequeIterator &operator+=(difference_type n) {
+                idx += n;
+                return *this;
+            }
+
+            DequeIterator &operator-=(difference_type n) {
+                idx -= n;
+                return *this;
+            }
+
+            DequeIterator operator+(difference_type n) const {
+                return DequeIterator(owner, idx + n);
+            }
+
+            friend DequeIterator operator+(difference_type n, const DequeIterator &it) {
+                return it + n;
+            }
+
+            DequeIterator operator-(difference_type n) const {
+                return DequeIterator(owner, idx - n);
+            }
+
+            difference_type operator-(const DequeIterator &other) const {
+                return idx - other.idx;
+            }
+
+            bool operator==(const DequeIterator &other) const {
+                return idx == other.idx;
+            }
+
+            bool operator!=(const DequeIterator &other) const {
+                return idx != other.idx;
+            }
+
+            std::strong_ordering operator<=>(const DequeIterator &other) const {
+                return idx <=> other.idx;
+            }
+
+            reference operator*() const {
+                return owner->slot(static_cast<std::size_t>(idx));
+            }
+
+            pointer operator->() const {
+                return &owner->slot(static_cast<std::size_t>(idx));
+            }
+
+            reference operator[](difference_type n) const {
+                return owner->slot(static_cast<std::size_t>(idx + n));
+            }
+
+            DequeIterator &next(std::size_t offset = 1) {
+                if (static_cast<std::size_t>(idx) + offset > owner->len) {
+                    throw std::out_of_range("DequeIterator::next. Offset is out of the collection.");
+                }
+                idx += static_cast<std::ptrdiff_t>(offset);
+                return *this;
+            }
+        };
+
+        using Iterator = DequeIterator<T>;
+        using ConstIterator = DequeIterator<const T>;
+        using ReverseIterator = std::reverse_iterator<Iterator>;
+        using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+        Deque() = default;
+
+        explicit Deque(const Allocator &alloc) : allocator(alloc) {
         }
 
         Deque(std::initializer_list<T> init) {
-            list = cont::List<T, Allocator>(init);
+            for (const T &val: init) {
+                emplace_back(val);
+            }
         }
 
-        Deque(const Deque &other) : cont::List<T, Allocator>(other.list) {
-            list = other.list;
+        Deque(const Deque &other)
+            : allocator(AllocTraits::select_on_container_copy_construction(other.allocator)) {
+            copyFrom(other);
         }
 
-        Deque(Deque &&other) noexcept {
-            list = other.list;
+        Deque(Deque &&other) noexcept : allocator(std::move(other.allocator)) {
+            steal(other);
         }
 
-        ~Deque() override {
-            list.clear();
+        ~Deque() {
+            release();
         }
 
         Deque &operator=(const Deque &other) {
             if (this != &other) {
-                list = other.list;
+                destroyAll();
+                copyFrom(other);
             }
             return *this;
         }
 
-        Deque &operator=(Deque &&other) noexcept {
-            if (this != &other) {
-                list = other.list;
+        Deque &operator=(Deque &&other) noexcept(AllocTraits::propagate_on_container_move_assignment::value
+                                                 || AllocTraits::is_always_equal::value) {
+            if (this == &other) {
+                return *this;
+            }
+            if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+                release();
+                allocator = std::move(other.allocator);
+                steal(other);
+            } else {
+                if (allocator == other.allocator) {
+                    release();
+                    steal(other);
+                } else {
+                    // Chunks from a foreign allocator cannot be adopted; move the elements instead.
+                    destroyAll();
+                    other.for_each_segment([this](T *first, T *last) {
+                        for (; first != last; ++first) {
+                            emplace_back(std::move(*first));
+                        }
+                    });
+                    other.clear();
+                }
             }
             return *this;
         }
 
         T &at(std::size_t pos) {
-            if (pos >= list.size()) {
+            if (pos >= len) {
                 throw std::out_of_range("Deque::at. Pos is unreal.");
             }
-            auto it = list.cbegin().next(pos);
-            return *it;
+            return slot(pos);
         }
 
         T &operator[](std::size_t pos) {
-            if (pos >= list.size()) {
+            if (pos >= len) {
                 throw std::out_of_range("Deque::[]. Pos is unreal.");
             }
-            auto it = list.cbegin();
-            while(pos > 0) {
-                ++it;
-                pos--;
+            return slot(pos);
+        }
+
+        T &front() {
+            if (len == 0) {
+                throw std::out_of_range("Deque::front. Deque is empty.");
             }
-            return *it;
+            return slot(0);
         }
 
-        T &front() override {
-            return list.front();
+        T &back() {
+            if (len == 0) {
+                throw std::out_of_range("Deque::back. Deque is empty.");
+            }
+            return slot(len - 1);
         }
 
-        T &back() override {
-            return list.back();
+        Iterator begin() const {
+            return Iterator(this, 0);
         }
 
-        using Iterator = cont::List<T, Allocator>::Iterator;
-        using ConstIterator = cont::List<T, Allocator>::ConstIterator;
-        using ReverseIterator = cont::List<T, Allocator>::ReverseIterator;
-        using ConstReverseIterator = cont::List<T, Allocator>::ConstReverseIterator;
+        Iterator end() const {
+            return Iterator(this, static_cast<std::ptrdiff_t>(len));
+        }
 
-        Iterator begin() const override {
-            return list.begin();
+        ConstIterator cbegin() const {
+            return ConstIterator(this, 0);
         }
 
-        Iterator end() const override {
-            return list.end();
+        ConstIterator cend() const {
+            return ConstIterator(this, static_cast<std::ptrdiff_t>(len));
         }
 
-        ConstIterator cbegin() const override {
-            return list.cbegin();
+        ReverseIterator rbegin() const {
+            return ReverseIterator(end());
         }
 
-        ConstIterator cend() const override {
-            return list.cend();
+        ReverseIterator rend() const {
+            return ReverseIterator(begin());
         }
 
-        ReverseIterator rbegin() const override {
-            return list.rbegin();
+        ConstReverseIterator crbegin() const {
+            return ConstReverseIterator(cend());
         }
 
-        ReverseIterator rend() const override {
-            return list.rend();
+        ConstReverseIterator crend() const {
+            return ConstReverseIterator(cbegin());
         }
 
-        ConstReverseIterator crbegin() const override {
-            return list.crbegin();
+        // Calls f(first, last) once per chunk with the contiguous run of elements it holds.
+        template<class F>
+        void for_each_segment(F f) const {
+            std::size_t pos = 0;
+            while (pos < len) {
+                std::size_t abs = start + pos;
+                std::size_t offset = abs & BlockMask;
+                std::size_t count = std::min(BlockSize - offset, len - pos);
+                T *first = map[abs >> BlockShift] + offset;
+                f(first, first + count);
+                pos += count;
+            }
         }
 
-        ConstReverseIterator crend() const override {
-            return list.crend();
+        [[nodiscard]] std::size_t size() const {
+            return len;
         }
 
-        [[nodiscard]] bool empty() const override {
-            return list.empty();
+        [[nodiscard]] std::size_t max_size() const {
+            return len;
         }
 
-        [[nodiscard]] std::size_t size() const override {
-            return list.size();
+        void clear() {
+            destroyAll();
         }
 
-        [[nodiscard]] std::size_t max_size() const override {
-            return list.max_size();
+        template<class... Args>
+        T &emplace_back(Args &&... args) {
+            reserveBack();
+            T *place = &slot(len);
+            std::construct_at(place, std::forward<Args>(args)...);
+            len++;
+            return *place;
         }
 
-        void clear() override {
-            list.clear();
+        template<class... Args>
+        T &emplace_front(Args &&... args) {
+            reserveFront();
+            T *place = &map[(start - 1) >> BlockShift][(start - 1) & BlockMask];
+            std::construct_at(place, std::forward<Args>(args)...);
+            start--;
+            len++;
+            return *place;
         }
 
-        void insert(ConstIterator posIter, T val) override {
-            list.insert(posIter, val);
+        // Shifts whichever side of pos is shorter.
+        void insert(ConstIterator posIter, T val) {
+            std::size_t pos = static_cast<std::size_t>(posIter.idx);
+            if (pos > len) {
+                throw std::out_of_range("Deque::insert. Pos is unreal.");
+            }
+            if (pos < len - pos) {
+                if (pos == 0) {
+                    emplace_front(std::move(val));
+                    return;
+                }
+                emplace_front(std::move(slot(0)));
+                for (std::size_t i = 1; i < pos; i++) {
+                    slot(i) = std::move(slot(i + 1));
+                }
+            } else {
+                if (pos == len) {
+                    emplace_back(std::move(val));
+                    return;
+                }
+                emplace_back(std::move(slot(len - 1)));
+                for (std::size_t i = len - 2; i > pos; i--) {
+                    slot(i) = std::move(slot(i - 1));
+                }
+            }
+            slot(pos) = std::move(val);
         }
 
-        Iterator erase(ConstIterator posIter) override {
-            return list.erase(posIter);
+        Iterator erase(ConstIterator posIter) {
+            std::size_t pos = static_cast<std::size_t>(posIter.idx);
+            if (pos >= len) {
+                throw std::out_of_range("Deque::erase. Offset is out of the collection.");
+            }
+            if (pos < len - pos - 1) {
+                for (std::size_t i = pos; i > 0; i--) {
+                    slot(i) = std::move(slot(i - 1));
+                }
+                pop_front();
+            } else {
+                for (std::size_t i = pos; i + 1 < len; i++) {
+                    slot(i) = std::move(slot(i + 1));
+                }
+                pop_back();
+            }
+            return Iterator(this, static_cast<std::ptrdiff_t>(pos));
         }
 
-        void push_back(T val) override {
-            list.push_back(val);
+        void push_back(const T &val) {
+            emplace_back(val);
         }
 
-        void pop_back() override {
-            list.pop_back();
+        void push_back(T &&val) {
+            emplace_back(std::move(val));
         }
 
-        void push_front(T val) override {
-            list.push_front(val);
+        void pop_back() {
+            if (len == 0) {
+                throw std::out_of_range("Deque::pop_back. Size is 0");
+            }
+            std::destroy_at(&slot(len - 1));
+            len--;
         }
 
-        void pop_front() override {
-            list.pop_front();
+        void push_front(const T &val) {
+            emplace_front(val);
         }
 
-        void resize(std::size_t newSize, T val) override {
-            list.resize(newSize, val);
+        void push_front(T &&val) {
+            emplace_front(std::move(val));
         }
 
-        void swap(Deque &other) noexcept {
-            list.swap(other.list);
+        void pop_front() {
+            if (len == 0) {
+                throw std::out_of_range("Deque::pop_front. Size is 0");
+            }
+            std::destroy_at(&slot(0));
+            start++;
+            len--;
         }
 
-        bool operator==(const Deque &other) const {
-            return list == other.list;
+        void resize(std::size_t newSize, const T &val) {
+            if (newSize == 0) {
+                throw std::out_of_range("Deque::resize. New size must be more than 0.");
+            }
+            while (len > newSize) {
+                pop_back();
+            }
+            while (len < newSize) {
+                emplace_back(val);
+            }
+        }
+
+        void swap(Deque &other) noexcept {
+            std::swap(allocator, other.allocator);
+            std::swap(map, other.map);
+            std::swap(mapSize, other.mapSize);
+            std::swap(start, other.start);
+            std::swap(len, other.len);
         }
 
-        bool operator!=(const Deque &other) const {
-            return !(*this == other);
+        bool operator==(const Deque &other) const {
+            if (len != other.len) {
+                return false;
+            }
+            for (std::size_t i = 0; i < len; i++) {
+                if (slot(i) != other.slot(i)) {
+                    return false;
+                }
+            }
+            return true;
         }
 
         std::strong_ordering operator<=>(const Deque &other) const {
-            return list <=> other.list;
+            std::size_t common = std::min(len, other.len);
+            for (std::size_t i = 0; i < common; i++) {
+                if (auto cmp = slot(i) <=> other.slot(i); cmp != 0) {
+                    return cmp;
+                }
+            }
+            return len <=> other.len;
         }
     };
 };
@@ -0,0 +1,247 @@
+#ifndef RING_DEQUE_H
+#define RING_DEQUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace contDQ {
+    enum class RingMode {
+        // One producer thread and one consumer thread; plain loads and stores of the two indices.
+        SPSC,
+        // Any number of producers and consumers; each cell carries a Vyukov sequence number.
+        MPMC
+    };
+
+    // Bounded lock-free FIFO for handing items between threads. Capacity must be a power of two.
+    // Producers push at the back, consumers pop at the front; pushes fail instead of blocking when
+    // the ring is full. Construction and destruction must not race with other operations.
+    template<class T, std::size_t Capacity, RingMode Mode = RingMode::MPMC>
+    class RingDeque {
+        static_assert(Capacity >= 2 && std::has_single_bit(Capacity), "RingDeque capacity must be a power of two");
+
+    private:
+        static constexpr std::size_t CacheLine = 64;
+        static constexpr std::size_t Mask = Capacity - 1;
+        static constexpr bool Multi = Mode == RingMode::MPMC;
+
+        struct NoSequence {
+        };
+
+        struct Cell {
+            [[no_unique_address]] std::conditional_t<Multi, std::atomic<std::size_t>, NoSequence> sequence;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T *value() {
+                return std::launder(reinterpret_cast<T *>(storage));
+            }
+        };
+
+        // Producer and consumer indices sit on separate lines so the two sides do not false-share.
+        // In SPSC mode each side also keeps a stale copy of the other's index and re-reads it
+        // only when the ring looks full (or empty).
+        alignas(CacheLine) std::atomic<std::size_t> tail{0};
+        std::size_t cachedHead = 0;
+        alignas(CacheLine) std::atomic<std::size_t> head{0};
+        std::size_t cachedTail = 0;
+        alignas(CacheLine) Cell cells[Capacity];
+
+        // SPSC: number of free cells the producer may fill, at most want.
+        std::size_t freeCells(std::size_t pos, std::size_t want) {
+            if (pos - cachedHead + want > Capacity) {
+                cachedHead = head.load(std::memory_order_acquire);
+            }
+            return std::min(want, Capacity - (pos - cachedHead));
+        }
+
+        // SPSC: number of filled cells the consumer may take, at most want.
+        std::size_t readyCells(std::size_t pos, std::size_t want) {
+            if (cachedTail - pos < want) {
+                cachedTail = tail.load(std::memory_order_acquire);
+            }
+            return std::min(want, cachedTail - pos);
+        }
+
+        // MPMC: claims up to want consecutive cells whose sequence equals pos + i + lag, advancing
+        // index by the number claimed. Returns the first claimed position and the count.
+        static std::pair<std::size_t, std::size_t> claim(std::atomic<std::size_t> &index, Cell *cells,
+                                                         std::size_t lag, std::size_t want) {
+            std::size_t pos = index.load(std::memory_order_relaxed);
+            if (want == 0) {
+                return {pos, 0};
+            }
+            while (true) {
+                std::size_t count = 0;
+                while (count < want) {
+                    std::size_t seq = cells[(pos + count) & Mask].sequence.load(std::memory_order_acquire);
+                    if (seq != pos + count + lag) {
+                        break;
+                    }
+                    count++;
+                }
+                if (count == 0) {
+                    std::size_t seq = cells[pos & Mask].sequence.load(std::memory_order_acquire);
+                    if (static_cast<std::ptrdiff_t>(seq - (pos + lag)) < 0) {
+                        return {pos, 0};
+                    }
+                    // Another thread already took pos; retry from the current index.
+                    pos = index.load(std::memory_order_relaxed);
+                    continue;
+                }
+                if (index.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                    return {pos, count};
+                }
+            }
+        }
+
+        template<class Make>
+        std::size_t pushWith(std::size_t want, Make make) {
+            if constexpr (Multi) {
+                auto [pos, count] = claim(tail, cells, 0, want);
+                for (std::size_t i = 0; i < count; i++) {
+                    Cell &cell = cells[(pos + i) & Mask];
+                    make(cell.storage);
+                    cell.sequence.store(pos + i + 1, std::memory_order_release);
+                }
+                return count;
+            } else {
+                std::size_t pos = tail.load(std::memory_order_relaxed);
+                std::size_t count = freeCells(pos, want);
+                std::size_t i = 0;
+                try {
+                    for (; i < count; i++) {
+                        make(cells[(pos + i) & Mask].storage);
+                    }
+                } catch (...) {
+                    tail.store(pos + i, std::memory_order_release);
+                    throw;
+                }
+                tail.store(pos + count, std::memory_order_release);
+                return count;
+            }
+        }
+
+        template<class Take>
+        std::size_t popWith(std::size_t want, Take take) {
+            if constexpr (Multi) {
+                auto [pos, count] = claim(head, cells, 1, want);
+                for (std::size_t i = 0; i < count; i++) {
+                    Cell &cell = cells[(pos + i) & Mask];
+                    take(std::move(*cell.value()));
+                    std::destroy_at(cell.value());
+                    cell.sequence.store(pos + i + Capacity, std::memory_order_release);
+                }
+                return count;
+            } else {
+                std::size_t pos = head.load(std::memory_order_relaxed);
+                std::size_t count = readyCells(pos, want);
+                for (std::size_t i = 0; i < count; i++) {
+                    T *val = cells[(pos + i) & Mask].value();
+                    take(std::move(*val));
+                    std::destroy_at(val);
+                }
+                head.store(pos + count, std::memory_order_release);
+                return count;
+            }
+        }
+
+    public:
+        using value_type = T;
+
+        RingDeque() {
+            if constexpr (Multi) {
+                for (std::size_t i = 0; i < Capacity; i++) {
+                    cells[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        RingDeque(const RingDeque &other) = delete;
+
+        ~RingDeque() {
+            std::size_t last = tail.load(std::memory_order_relaxed);
+            for (std::size_t pos = head.load(std::memory_order_relaxed); pos != last; pos++) {
+                Cell &cell = cells[pos & Mask];
+                if constexpr (Multi) {
+                    // Skip cells whose producer claimed them but failed to construct.
+                    if (cell.sequence.load(std::memory_order_relaxed) != pos + 1) {
+                        continue;
+                    }
+                }
+                std::destroy_at(cell.value());
+            }
+        }
+
+        RingDeque &operator=(const RingDeque &other) = delete;
+
+        // The emplace and push calls return false, leaving the arguments untouched, when the ring is full.
+        // In MPMC mode a constructor that throws leaves its cell claimed and blocks consumers at it,
+        // so T should be nothrow-constructible from the arguments.
+        template<class... Args>
+        bool try_emplace_back(Args &&... args) {
+            return pushWith(1, [&](unsigned char *place) {
+                ::new(static_cast<void *>(place)) T(std::forward<Args>(args)...);
+            }) == 1;
+        }
+
+        bool try_push_back(const T &val) {
+            return try_emplace_back(val);
+        }
+
+        bool try_push_back(T &&val) {
+            return try_emplace_back(std::move(val));
+        }
+
+        bool try_pop_front(T &out) {
+            return popWith(1, [&out](T &&val) { out = std::move(val); }) == 1;
+        }
+
+        std::optional<T> pop_front() {
+            std::optional<T> out;
+            popWith(1, [&out](T &&val) { out.emplace(std::move(val)); });
+            return out;
+        }
+
+        // Copies up to n items starting at first into consecutive cells, publishing them together.
+        // Returns how many were pushed; the rest did not fit.
+        template<class InputIt>
+        std::size_t push_n(InputIt first, std::size_t n) {
+            return pushWith(n, [&first](unsigned char *place) {
+                ::new(static_cast<void *>(place)) T(*first);
+                ++first;
+            });
+        }
+
+        // Moves up to n items into out. Returns how many were popped.
+        template<class OutputIt>
+        std::size_t pop_n(OutputIt out, std::size_t n) {
+            return popWith(n, [&out](T &&val) {
+                *out = std::move(val);
+                ++out;
+            });
+        }
+
+        // A snapshot: another thread may push or pop right after the check.
+        [[nodiscard]] std::size_t size_approx() const {
+            std::size_t first = head.load(std::memory_order_acquire);
+            std::size_t last = tail.load(std::memory_order_acquire);
+            return last - first > Capacity ? 0 : last - first;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return size_approx() == 0;
+        }
+
+        [[nodiscard]] static constexpr std::size_t capacity() {
+            return Capacity;
+        }
+    };
+}
+
+#endif //RING_DEQUE_H
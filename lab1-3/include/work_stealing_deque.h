@@ -0,0 +1,151 @@
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace contDQ {
+    // Chase–Lev work-stealing deque. One owner thread pushes and pops at the bottom (LIFO);
+    // any number of thieves steal from the top (FIFO) without locks. The circular buffer
+    // doubles when full; outgrown buffers are kept until destruction because a thief may
+    // still be reading from one. T is copied through atomics, so it must be trivially
+    // copyable — typically a task pointer or index.
+    template<class T>
+    class WorkStealingDeque {
+        static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque stores T in atomics");
+
+    private:
+        static constexpr std::size_t CacheLine = 64;
+
+        class Buffer {
+        private:
+            std::int64_t mask;
+            std::unique_ptr<std::atomic<T>[]> slots;
+
+        public:
+            explicit Buffer(std::int64_t capacity)
+                : mask(capacity - 1), slots(std::make_unique<std::atomic<T>[]>(static_cast<std::size_t>(capacity))) {
+            }
+
+            [[nodiscard]] std::int64_t capacity() const {
+                return mask + 1;
+            }
+
+            T get(std::int64_t idx) const {
+                return slots[static_cast<std::size_t>(idx & mask)].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t idx, T val) {
+                slots[static_cast<std::size_t>(idx & mask)].store(val, std::memory_order_relaxed);
+            }
+
+            // A buffer twice the size holding the live range [top, bottom).
+            std::unique_ptr<Buffer> grow(std::int64_t top, std::int64_t bottom) const {
+                auto bigger = std::make_unique<Buffer>(capacity() * 2);
+                for (std::int64_t i = top; i < bottom; i++) {
+                    bigger->put(i, get(i));
+                }
+                return bigger;
+            }
+        };
+
+        alignas(CacheLine) std::atomic<std::int64_t> top{0};
+        alignas(CacheLine) std::atomic<std::int64_t> bottom{0};
+        std::atomic<Buffer *> buffer;
+        // Owner-only: every buffer ever used, the current one last.
+        std::vector<std::unique_ptr<Buffer> > buffers;
+
+    public:
+        using value_type = T;
+
+        explicit WorkStealingDeque(std::size_t capacity = 64) {
+            std::int64_t cap = 2;
+            while (cap < static_cast<std::int64_t>(capacity)) {
+                cap *= 2;
+            }
+            buffers.push_back(std::make_unique<Buffer>(cap));
+            buffer.store(buffers.back().get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque &other) = delete;
+
+        WorkStealingDeque &operator=(const WorkStealingDeque &other) = delete;
+
+        // Owner only.
+        void push(T val) {
+            std::int64_t b = bottom.load(std::memory_order_relaxed);
+            std::int64_t t = top.load(std::memory_order_acquire);
+            Buffer *buf = buffer.load(std::memory_order_relaxed);
+            if (b - t > buf->capacity() - 1) {
+                buffers.push_back(buf->grow(t, b));
+                buf = buffers.back().get();
+                buffer.store(buf, std::memory_order_release);
+            }
+            buf->put(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Owner only. Takes the most recently pushed item; races with thieves only for the last one.
+        std::optional<T> pop() {
+            std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+            Buffer *buf = buffer.load(std::memory_order_relaxed);
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top.load(std::memory_order_relaxed);
+            if (t > b) {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+            T val = buf->get(b);
+            if (t == b) {
+                bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                       std::memory_order_relaxed);
+                bottom.store(b + 1, std::memory_order_relaxed);
+                if (!won) {
+                    return std::nullopt;
+                }
+            }
+            return val;
+        }
+
+        // Any thread. Takes the oldest item; returns nothing if the deque is empty or another
+        // thief (or the owner) won the race for it.
+        std::optional<T> steal() {
+            std::int64_t t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t b = bottom.load(std::memory_order_acquire);
+            if (t >= b) {
+                return std::nullopt;
+            }
+            Buffer *buf = buffer.load(std::memory_order_acquire);
+            T val = buf->get(t);
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return std::nullopt;
+            }
+            return val;
+        }
+
+        // A snapshot: thieves may take items right after the check.
+        [[nodiscard]] std::size_t size_approx() const {
+            std::int64_t b = bottom.load(std::memory_order_relaxed);
+            std::int64_t t = top.load(std::memory_order_relaxed);
+            return b > t ? static_cast<std::size_t>(b - t) : 0;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return size_approx() == 0;
+        }
+
+        [[nodiscard]] std::size_t capacity() const {
+            return static_cast<std::size_t>(buffer.load(std::memory_order_relaxed)->capacity());
+        }
+    };
+}
+
+#endif //WORK_STEALING_DEQUE_H
@@ -1,5 +1,11 @@
 #include "deque.h"
+#include "ring_deque.h"
+#include "work_stealing_deque.h"
 #include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
 
 class DqTest : public ::testing::Test {
 protected:
@@ -51,6 +57,24 @@ TEST(Constructors, MoveConstructor) {
     }
 }
 
+TEST(Constructors, MoveStealsStorage) {
+    contDQ::Deque<int> dq;
+    for (int i = 0; i < 5000; i++) {
+        dq.push_back(i);
+    }
+    const int *first = &dq.front();
+    contDQ::Deque<int> dq2 = std::move(dq);
+    EXPECT_EQ(dq.size(), 0);
+    EXPECT_EQ(&dq2.front(), first);
+    contDQ::Deque<int> dq3 = {1};
+    dq3 = std::move(dq2);
+    EXPECT_EQ(dq2.size(), 0);
+    EXPECT_EQ(&dq3.front(), first);
+    EXPECT_EQ(dq3.size(), 5000);
+    dq2.push_back(42);
+    EXPECT_EQ(dq2.front(), 42);
+}
+
 TEST(Constructors, CopyEmptyDeque) {
     contDQ::Deque<int> dq;
     contDQ::Deque<int> dq2 = dq;
@@ -161,8 +185,8 @@ TEST(operatorEq, MoveOperator) {
     contDQ::Deque<int> dq = {1, 3, 5, 7};
     contDQ::Deque<int> dq2;
     dq2 = std::move(dq);
-    EXPECT_EQ(dq.size(), dq2.size());
-    EXPECT_EQ(dq.size(), 4);
+    EXPECT_EQ(dq.size(), 0);
+    EXPECT_EQ(dq2.size(), 4);
     int i = 1;
     for (int x: dq2) {
         EXPECT_EQ(x, i);
@@ -505,6 +529,269 @@ TEST(compare, spaceship) {
     EXPECT_TRUE(dq1 < dq3);
 }
 
+TEST(index, sequentialAfterModification) {
+    contDQ::Deque<int> d;
+    for (int i = 0; i < 50; i++) {
+        d.push_back(i);
+    }
+    for (std::size_t i = 0; i < d.size(); i++) {
+        ASSERT_EQ(d[i], static_cast<int>(i));
+    }
+    d.pop_front();
+    d.push_front(100);
+    d.insert(d.cbegin().next(10), 200);
+    ASSERT_EQ(d[0], 100);
+    ASSERT_EQ(d.at(10), 200);
+    ASSERT_EQ(d.at(11), 10);
+    ASSERT_EQ(d[50], 49);
+}
+
+TEST(chunks, growBothEnds) {
+    contDQ::Deque<int> d;
+    const int n = static_cast<int>(contDQ::Deque<int>::BlockSize) * 5 + 3;
+    for (int i = 0; i < n; i++) {
+        d.push_back(i);
+        d.push_front(-i - 1);
+    }
+    ASSERT_EQ(d.size(), static_cast<std::size_t>(2 * n));
+    for (int i = 0; i < 2 * n; i++) {
+        ASSERT_EQ(d[i], i - n);
+    }
+    auto it = d.begin();
+    it += n;
+    EXPECT_EQ(*it, 0);
+    EXPECT_EQ(d.end() - d.begin(), 2 * n);
+    EXPECT_EQ(it[-1], -1);
+}
+
+TEST(chunks, queueDoesNotLeakMap) {
+    contDQ::Deque<std::string> d;
+    for (int i = 0; i < 100'000; i++) {
+        d.push_back(std::to_string(i));
+        if (i >= 10) {
+            ASSERT_EQ(d.front(), std::to_string(i - 10));
+            d.pop_front();
+        }
+    }
+    EXPECT_EQ(d.size(), 10);
+    EXPECT_EQ(d.back(), "99999");
+}
+
+TEST(chunks, segmentsCoverElements) {
+    contDQ::Deque<int> d;
+    const int n = static_cast<int>(contDQ::Deque<int>::BlockSize) * 3;
+    for (int i = 0; i < n; i++) {
+        d.push_front(n - 1 - i);
+    }
+    int expected = 0;
+    std::size_t segments = 0;
+    d.for_each_segment([&](const int *first, const int *last) {
+        segments++;
+        for (; first != last; ++first) {
+            ASSERT_EQ(*first, expected++);
+        }
+    });
+    EXPECT_EQ(expected, n);
+    EXPECT_GE(segments, 3);
+    EXPECT_LE(segments, 4);
+}
+
+TEST(chunks, insertEraseMiddle) {
+    contDQ::Deque<std::string> d;
+    for (int i = 0; i < 10; i++) {
+        d.push_back(std::to_string(i));
+    }
+    d.insert(d.cbegin().next(2), "a");
+    d.insert(d.cbegin().next(8), "b");
+    contDQ::Deque<std::string> expected = {"0", "1", "a", "2", "3", "4", "5", "6", "b", "7", "8", "9"};
+    EXPECT_EQ(d, expected);
+    auto it = d.erase(d.cbegin().next(2));
+    EXPECT_EQ(*it, "2");
+    it = d.erase(d.cbegin().next(7));
+    EXPECT_EQ(*it, "7");
+    contDQ::Deque<std::string> restored = {"0", "1", "2", "3", "4", "5", "6", "7", "8", "9"};
+    EXPECT_EQ(d, restored);
+}
+
+TEST(ring, fullAndWrapAround) {
+    contDQ::RingDeque<std::string, 4, contDQ::RingMode::SPSC> ring;
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 4; i++) {
+            ASSERT_TRUE(ring.try_push_back(std::to_string(round * 4 + i)));
+        }
+        std::string extra = "x";
+        EXPECT_FALSE(ring.try_push_back(std::move(extra)));
+        EXPECT_EQ(extra, "x");
+        EXPECT_EQ(ring.size_approx(), 4);
+        for (int i = 0; i < 4; i++) {
+            EXPECT_EQ(ring.pop_front(), std::to_string(round * 4 + i));
+        }
+        EXPECT_FALSE(ring.pop_front().has_value());
+    }
+    EXPECT_TRUE(ring.try_emplace_back(3, 'a'));
+}
+
+TEST(ring, batchPartial) {
+    contDQ::RingDeque<int, 8> ring;
+    std::vector<int> in = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    EXPECT_EQ(ring.push_n(in.begin(), in.size()), 8);
+    EXPECT_EQ(ring.push_n(in.begin(), 1), 0);
+    std::vector<int> out;
+    EXPECT_EQ(ring.pop_n(std::back_inserter(out), 5), 5);
+    EXPECT_EQ(ring.push_n(in.begin() + 8, 2), 2);
+    EXPECT_EQ(ring.pop_n(std::back_inserter(out), 100), 5);
+    EXPECT_EQ(out, in);
+    EXPECT_TRUE(ring.empty());
+}
+
+template<contDQ::RingMode Mode>
+void zeroLengthBatches() {
+    contDQ::RingDeque<int, 8, Mode> ring;
+    std::vector<int> in = {1, 2, 3};
+    std::vector<int> out;
+    EXPECT_EQ(ring.push_n(in.begin(), 0), 0);
+    EXPECT_EQ(ring.pop_n(std::back_inserter(out), 0), 0);
+    EXPECT_EQ(ring.push_n(in.begin(), 3), 3);
+    EXPECT_EQ(ring.push_n(in.begin(), 0), 0);
+    EXPECT_EQ(ring.pop_n(std::back_inserter(out), 0), 0);
+    EXPECT_EQ(ring.size_approx(), 3);
+    EXPECT_EQ(ring.pop_n(std::back_inserter(out), 3), 3);
+    EXPECT_EQ(out, in);
+}
+
+TEST(ring, zeroLengthBatches) {
+    zeroLengthBatches<contDQ::RingMode::SPSC>();
+    zeroLengthBatches<contDQ::RingMode::MPMC>();
+}
+
+TEST(ring, spscKeepsOrder) {
+    contDQ::RingDeque<int, 64, contDQ::RingMode::SPSC> ring;
+    const int n = 200'000;
+    std::thread producer([&ring] {
+        int batch[5];
+        for (int i = 0; i < n;) {
+            int k = std::min(5, n - i);
+            for (int j = 0; j < k; j++) {
+                batch[j] = i + j;
+            }
+            std::size_t pushed = ring.push_n(batch, k);
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            i += static_cast<int>(pushed);
+        }
+    });
+    int expected = 0;
+    while (expected < n) {
+        int val;
+        if (ring.try_pop_front(val)) {
+            ASSERT_EQ(val, expected);
+            expected++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
+
+TEST(ring, mpmcDeliversEachItemOnce) {
+    contDQ::RingDeque<int, 128> ring;
+    const int producers = 4;
+    const int consumers = 4;
+    const int perProducer = 50'000;
+    std::vector<std::atomic<int> > seen(producers * perProducer);
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&ring, p] {
+            for (int i = 0; i < perProducer; i++) {
+                while (!ring.try_push_back(p * perProducer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&] {
+            int buf[8];
+            while (consumed.load() < producers * perProducer) {
+                std::size_t got = ring.pop_n(buf, 8);
+                if (got == 0) {
+                    std::this_thread::yield();
+                }
+                for (std::size_t i = 0; i < got; i++) {
+                    seen[buf[i]].fetch_add(1);
+                }
+                consumed.fetch_add(static_cast<int>(got));
+            }
+        });
+    }
+    for (auto &t: threads) {
+        t.join();
+    }
+    for (auto &count: seen) {
+        ASSERT_EQ(count.load(), 1);
+    }
+}
+
+TEST(stealing, ownerLifoThiefFifo) {
+    contDQ::WorkStealingDeque<int> dq(2);
+    for (int i = 0; i < 100; i++) {
+        dq.push(i);
+    }
+    EXPECT_GE(dq.capacity(), 100);
+    EXPECT_EQ(dq.size_approx(), 100);
+    EXPECT_EQ(dq.steal(), 0);
+    EXPECT_EQ(dq.steal(), 1);
+    EXPECT_EQ(dq.pop(), 99);
+    for (int i = 98; i >= 2; i--) {
+        ASSERT_EQ(dq.pop(), i);
+    }
+    EXPECT_FALSE(dq.pop().has_value());
+    EXPECT_FALSE(dq.steal().has_value());
+    EXPECT_TRUE(dq.empty());
+}
+
+TEST(stealing, eachItemTakenOnce) {
+    contDQ::WorkStealingDeque<int> dq(4);
+    const int n = 200'000;
+    std::vector<std::atomic<int> > seen(n);
+    std::atomic<bool> done{false};
+    std::vector<std::thread> thieves;
+    for (int k = 0; k < 3; k++) {
+        thieves.emplace_back([&] {
+            while (!done.load()) {
+                if (auto val = dq.steal()) {
+                    seen[*val].fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int i = 0; i < n; i++) {
+        dq.push(i);
+        if (i % 3 == 0) {
+            if (auto val = dq.pop()) {
+                seen[*val].fetch_add(1);
+            }
+        }
+    }
+    while (auto val = dq.pop()) {
+        seen[*val].fetch_add(1);
+    }
+    done.store(true);
+    for (auto &t: thieves) {
+        t.join();
+    }
+    while (auto val = dq.steal()) {
+        seen[*val].fetch_add(1);
+    }
+    for (auto &count: seen) {
+        ASSERT_EQ(count.load(), 1);
+    }
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
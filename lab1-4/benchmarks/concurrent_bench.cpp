@@ -0,0 +1,72 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "concurrent_stack.h"
+#include "stack.h"
+
+// The baseline: the free-list pattern of a shared st::Stack behind a mutex.
+class LockedStack {
+private:
+    std::mutex mutex;
+    st::Stack<int> stack;
+
+public:
+    void push(int val) {
+        std::lock_guard lock(mutex);
+        stack.push(val);
+    }
+
+    std::optional<int> pop() {
+        std::lock_guard lock(mutex);
+        if (stack.empty()) {
+            return std::nullopt;
+        }
+        int val = stack.top();
+        stack.pop();
+        return val;
+    }
+};
+
+// Every thread alternates push and pop, as threads sharing a free list do.
+template<class S>
+double run(std::size_t threadCount, std::size_t opsPerThread) {
+    auto stack = std::make_unique<S>();
+    for (int i = 0; i < 1024; i++) {
+        stack->push(i);
+    }
+    std::vector<std::thread> threads;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t t = 0; t < threadCount; t++) {
+        threads.emplace_back([&stack, opsPerThread] {
+            for (std::size_t i = 0; i < opsPerThread; i++) {
+                stack->push(static_cast<int>(i));
+                stack->pop();
+            }
+        });
+    }
+    for (auto &t: threads) {
+        t.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    return static_cast<double>(threadCount * opsPerThread * 2) / ms / 1000.0;
+}
+
+int main(int argc, char **argv) {
+    std::size_t opsPerThread = argc > 1 ? std::stoull(argv[1]) : 200'000;
+    std::size_t maxThreads = argc > 2 ? std::stoull(argv[2]) : 64;
+    std::cout << "threads, Mops/s: mutex+Stack, Treiber, Treiber+elimination" << std::endl;
+    for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        double locked = run<LockedStack>(threads, opsPerThread);
+        double treiber = run<st::ConcurrentStack<int, std::allocator<int>, false> >(threads, opsPerThread);
+        double elimination = run<st::ConcurrentStack<int> >(threads, opsPerThread);
+        std::cout << threads << ", " << locked << ", " << treiber << ", " << elimination << std::endl;
+    }
+    return 0;
+}
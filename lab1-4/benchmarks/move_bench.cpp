@@ -0,0 +1,40 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include "stack.h"
+
+template<class C, class Fill, class Transfer>
+void run(const char *name, std::size_t count, std::size_t rounds, Fill fill, Transfer transfer) {
+    C a;
+    C b;
+    for (std::size_t i = 0; i < count; i++) {
+        fill(a, static_cast<int>(i));
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < rounds; r++) {
+        transfer(b, a);
+        transfer(a, b);
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << name << " N=" << count << " x" << 2 * rounds << ": "
+            << std::chrono::duration<double, std::milli>(end - start).count() << " ms"
+            << " (" << a.size() << ")" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 100'000;
+    std::size_t rounds = argc > 2 ? std::stoull(argv[2]) : 100;
+
+    auto dequeFill = [](contDQ::Deque<int> &d, int v) { d.push_back(v); };
+    auto stackFill = [](st::Stack<int> &s, int v) { s.push(v); };
+    auto copy = [](auto &to, auto &from) { to = from; };
+    auto move = [](auto &to, auto &from) { to = std::move(from); };
+
+    run<contDQ::Deque<int> >("Deque copy-assign", count, rounds, dequeFill, copy);
+    run<contDQ::Deque<int> >("Deque move-assign", count, rounds, dequeFill, move);
+    run<st::Stack<int> >("Stack copy-assign", count, rounds, stackFill, copy);
+    run<st::Stack<int> >("Stack move-assign", count, rounds, stackFill, move);
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include "stack.h"
+
+template<class S>
+void run(const char *name, std::size_t count, bool reserve) {
+    S stack;
+    long long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    if constexpr (requires { stack.reserve(count); }) {
+        if (reserve) {
+            stack.reserve(count);
+        }
+    }
+    for (std::size_t i = 0; i < count; i++) {
+        stack.push(static_cast<int>(i));
+    }
+    auto pushed = std::chrono::steady_clock::now();
+    // Mixed phase: the shape of an evaluation stack, shallow pushes and pops near the top.
+    for (std::size_t i = 0; i < count; i++) {
+        stack.push(static_cast<int>(i));
+        stack.push(static_cast<int>(i));
+        sum += stack.top();
+        stack.pop();
+        sum += stack.top();
+        stack.pop();
+    }
+    auto mixed = std::chrono::steady_clock::now();
+    while (!stack.empty()) {
+        sum += stack.top();
+        stack.pop();
+    }
+    auto popped = std::chrono::steady_clock::now();
+
+    std::cout << name << " N=" << count
+            << " push: " << std::chrono::duration<double, std::milli>(pushed - start).count() << " ms"
+            << ", push/pop at top: " << std::chrono::duration<double, std::milli>(mixed - pushed).count() << " ms"
+            << ", pop: " << std::chrono::duration<double, std::milli>(popped - mixed).count() << " ms"
+            << " (" << sum << ")" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 1'000'000;
+    run<st::Stack<int> >("Stack<Vector>          ", count, false);
+    run<st::Stack<int> >("Stack<Vector> reserved ", count, true);
+    run<st::Stack<int, contDQ::Deque<int> > >("Stack<Deque>           ", count, false);
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include "stack.h"
+
+// Counts every heap allocation made by the program.
+static std::size_t allocations = 0;
+
+void *operator new(std::size_t size) {
+    allocations++;
+    if (void *ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+// Forwards to std::allocator. Any other allocator keeps cont::Vector from switching to
+// malloc/realloc for trivially relocatable elements, which the counter above cannot see.
+template<class T>
+struct NewAllocator : std::allocator<T> {
+    NewAllocator() = default;
+
+    template<class U>
+    NewAllocator(const NewAllocator<U> &) {
+    }
+
+    template<class U>
+    struct rebind {
+        using other = NewAllocator<U>;
+    };
+};
+
+// Evaluates a synthetic postfix expression of the given depth with a fresh stack each time,
+// the way an expression evaluator creates one stack per call.
+template<class S>
+void run(const char *name, std::size_t count, int depth) {
+    long long sum = 0;
+    std::size_t before = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < count; i++) {
+        S stack;
+        for (int d = 0; d < depth; d++) {
+            stack.push(static_cast<long long>(i) + d);
+        }
+        while (stack.size() > 1) {
+            long long rhs = stack.top();
+            stack.pop();
+            long long lhs = stack.top();
+            stack.pop();
+            stack.push(lhs + rhs);
+        }
+        sum += stack.top();
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << name << " depth=" << depth << " x" << count << ": "
+            << std::chrono::duration<double, std::milli>(end - start).count() << " ms, "
+            << allocations - before << " allocations (" << sum << ")" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 200'000;
+    for (int depth: {4, 16, 48, 100}) {
+        run<st::Stack<long long, cont::Vector<long long, NewAllocator<long long> > > >("Stack<Vector>       ",
+                                                                                   count, depth);
+        run<st::Stack<long long, contDQ::Deque<long long> > >("Stack<Deque>        ", count, depth);
+        run<st::Stack<long long, cont::SmallVector<long long, 64, NewAllocator<long long> > > >(
+            "SmallStack<64>      ", count, depth);
+    }
+    return 0;
+}
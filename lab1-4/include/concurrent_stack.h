@@ -0,0 +1,288 @@
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace st {
+    // Lock-free LIFO (Treiber stack). push and pop may be called from any number of threads;
+    // popped nodes are reclaimed through hazard pointers, so a node cannot be recycled while a
+    // pop still compares against it and the top CAS is free of ABA. With Eliminate, a push and a
+    // pop that both lose the top CAS try to meet in a side array and cancel out without touching
+    // top. Construction and destruction must not race with other operations.
+    template<class T, class Allocator = std::allocator<T>, bool Eliminate = true>
+    class ConcurrentStack {
+    private:
+        struct Node {
+            Node *next = nullptr;
+            alignas(T) unsigned char storage[sizeof(T)];
+
+            T *value() {
+                return std::launder(reinterpret_cast<T *>(storage));
+            }
+        };
+
+        using NodeAllocator = std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+        using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+        static constexpr std::size_t CacheLine = 64;
+        static constexpr std::size_t HazardSlots = 128;
+        static constexpr std::size_t RetireThreshold = 2 * HazardSlots;
+        static constexpr std::size_t EliminationSlots = 8;
+        static constexpr std::size_t EliminationSpins = 64;
+
+        // One slot per in-flight pop; a thread claims a free slot for the duration of a call.
+        struct alignas(CacheLine) HazardRecord {
+            std::atomic<bool> active{false};
+            std::atomic<Node *> hazard{nullptr};
+            std::vector<Node *> retired;
+        };
+
+        class Guard {
+        private:
+            HazardRecord *record;
+
+        public:
+            explicit Guard(ConcurrentStack &stack) : record(stack.acquireRecord()) {
+            }
+
+            Guard(const Guard &other) = delete;
+
+            ~Guard() {
+                record->hazard.store(nullptr, std::memory_order_release);
+                record->active.store(false, std::memory_order_release);
+            }
+
+            Guard &operator=(const Guard &other) = delete;
+
+            HazardRecord &operator*() const {
+                return *record;
+            }
+
+            HazardRecord *operator->() const {
+                return record;
+            }
+        };
+
+        struct alignas(CacheLine) Exchanger {
+            std::atomic<Node *> offer{nullptr};
+        };
+
+        [[no_unique_address]] NodeAllocator allocator;
+        alignas(CacheLine) std::atomic<Node *> top{nullptr};
+        HazardRecord records[HazardSlots];
+        Exchanger exchangers[EliminationSlots];
+
+        static std::size_t threadHint() {
+            static thread_local std::size_t hint = std::hash<std::thread::id>()(std::this_thread::get_id());
+            return hint;
+        }
+
+        HazardRecord *acquireRecord() {
+            static thread_local std::size_t hint = threadHint() % HazardSlots;
+            for (std::size_t attempt = 0;; attempt++) {
+                std::size_t idx = (hint + attempt) % HazardSlots;
+                HazardRecord &record = records[idx];
+                if (!record.active.load(std::memory_order_relaxed)
+                    && !record.active.exchange(true, std::memory_order_acquire)) {
+                    hint = idx;
+                    return &record;
+                }
+                if (attempt % HazardSlots == HazardSlots - 1) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        Node *allocateNode() {
+            Node *node = NodeTraits::allocate(allocator, 1);
+            ::new(static_cast<void *>(node)) Node;
+            return node;
+        }
+
+        void freeNode(Node *node) noexcept {
+            std::destroy_at(node);
+            NodeTraits::deallocate(allocator, node, 1);
+        }
+
+        void retire(HazardRecord &record, Node *node) {
+            record.retired.push_back(node);
+            if (record.retired.size() < RetireThreshold) {
+                return;
+            }
+            std::vector<Node *> hazards;
+            hazards.reserve(HazardSlots);
+            for (HazardRecord &other: records) {
+                if (Node *ptr = other.hazard.load(std::memory_order_seq_cst); ptr != nullptr) {
+                    hazards.push_back(ptr);
+                }
+            }
+            std::sort(hazards.begin(), hazards.end());
+            std::size_t kept = 0;
+            for (Node *ptr: record.retired) {
+                if (std::binary_search(hazards.begin(), hazards.end(), ptr)) {
+                    record.retired[kept++] = ptr;
+                } else {
+                    freeNode(ptr);
+                }
+            }
+            record.retired.resize(kept);
+        }
+
+        Exchanger &pickExchanger(std::size_t attempt) {
+            return exchangers[(threadHint() + attempt) % EliminationSlots];
+        }
+
+        // Offers node to a concurrent pop for a short while. True if a pop took it; the node
+        // then belongs to that pop. Offered nodes are never dereferenced before they are taken.
+        bool offerPush(Node *node, std::size_t attempt) {
+            Exchanger &slot = pickExchanger(attempt);
+            Node *expected = nullptr;
+            if (!slot.offer.compare_exchange_strong(expected, node, std::memory_order_release,
+                                                    std::memory_order_relaxed)) {
+                return false;
+            }
+            for (std::size_t spin = 0; spin < EliminationSpins; spin++) {
+                if (slot.offer.load(std::memory_order_acquire) != node) {
+                    return true;
+                }
+            }
+            expected = node;
+            return !slot.offer.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed,
+                                                       std::memory_order_relaxed);
+        }
+
+        // Takes a node offered by a concurrent push, if any.
+        Node *takeOffer(std::size_t attempt) {
+            Exchanger &slot = pickExchanger(attempt);
+            Node *node = slot.offer.load(std::memory_order_acquire);
+            if (node != nullptr && slot.offer.compare_exchange_strong(node, nullptr, std::memory_order_acquire,
+                                                                      std::memory_order_relaxed)) {
+                return node;
+            }
+            return nullptr;
+        }
+
+        template<class Consume>
+        bool popWith(Consume consume) {
+            Node *taken = nullptr;
+            {
+                Guard guard(*this);
+                for (std::size_t attempt = 0;; attempt++) {
+                    Node *first = top.load(std::memory_order_relaxed);
+                    guard->hazard.store(first, std::memory_order_seq_cst);
+                    if (first != top.load(std::memory_order_seq_cst)) {
+                        continue;
+                    }
+                    if (first == nullptr) {
+                        return false;
+                    }
+                    if (top.compare_exchange_strong(first, first->next, std::memory_order_acquire,
+                                                    std::memory_order_relaxed)) {
+                        consume(std::move(*first->value()));
+                        std::destroy_at(first->value());
+                        guard->hazard.store(nullptr, std::memory_order_release);
+                        retire(*guard, first);
+                        return true;
+                    }
+                    if constexpr (Eliminate) {
+                        if ((taken = takeOffer(attempt)) != nullptr) {
+                            break;
+                        }
+                    }
+                }
+            }
+            // Never published on top, so no other thread can be looking at it.
+            consume(std::move(*taken->value()));
+            std::destroy_at(taken->value());
+            freeNode(taken);
+            return true;
+        }
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+
+        ConcurrentStack() : ConcurrentStack(Allocator()) {
+        }
+
+        explicit ConcurrentStack(const Allocator &alloc) : allocator(alloc) {
+        }
+
+        ConcurrentStack(const ConcurrentStack &other) = delete;
+
+        ~ConcurrentStack() {
+            Node *node = top.load(std::memory_order_relaxed);
+            while (node != nullptr) {
+                Node *next = node->next;
+                std::destroy_at(node->value());
+                freeNode(node);
+                node = next;
+            }
+            for (HazardRecord &record: records) {
+                for (Node *ptr: record.retired) {
+                    freeNode(ptr);
+                }
+            }
+        }
+
+        ConcurrentStack &operator=(const ConcurrentStack &other) = delete;
+
+        template<class... Args>
+        void emplace(Args &&... args) {
+            Node *node = allocateNode();
+            try {
+                std::construct_at(node->value(), std::forward<Args>(args)...);
+            } catch (...) {
+                freeNode(node);
+                throw;
+            }
+            node->next = top.load(std::memory_order_relaxed);
+            for (std::size_t attempt = 0;; attempt++) {
+                if (top.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+                    return;
+                }
+                if constexpr (Eliminate) {
+                    if (offerPush(node, attempt)) {
+                        return;
+                    }
+                    node->next = top.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        void push(const T &val) {
+            emplace(val);
+        }
+
+        void push(T &&val) {
+            emplace(std::move(val));
+        }
+
+        bool try_pop(T &out) {
+            return popWith([&out](T &&val) { out = std::move(val); });
+        }
+
+        std::optional<T> pop() {
+            std::optional<T> out;
+            popWith([&out](T &&val) { out.emplace(std::move(val)); });
+            return out;
+        }
+
+        // A snapshot: another thread may push or pop right after the check.
+        [[nodiscard]] bool empty() const {
+            return top.load(std::memory_order_acquire) == nullptr;
+        }
+    };
+}
+
+#endif //CONCURRENT_STACK_H
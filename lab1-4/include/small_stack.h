@@ -0,0 +1,13 @@
+#ifndef SMALL_STACK_H
+#define SMALL_STACK_H
+
+#include "stack.h"
+#include <cstddef>
+
+namespace st {
+    // Stack whose first N elements never touch the heap.
+    template<class T, std::size_t N = 64>
+    using SmallStack = Stack<T, cont::SmallVector<T, N> >;
+}
+
+#endif //SMALL_STACK_H
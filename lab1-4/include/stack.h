@@ -2,10 +2,18 @@
 #define STACK_H
 
 #include "../../lab1-3/include/deque.h"
+#include "../../lab1-5/include/vector.h"
 #include <iostream>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
 
 namespace st {
-    template<class T, class Container = contDQ::Deque<T> >
+    // Adapter over any container with back/push_back/emplace_back/pop_back. The default keeps
+    // elements contiguous, so push and top touch one cache line instead of a chunk map;
+    // contDQ::Deque remains available as the Container argument.
+    template<class T, class Container = cont::Vector<T> >
     class Stack {
     private:
         Container cont;
@@ -17,24 +25,20 @@ namespace st {
 
         Stack(const Stack &other) : cont(other.cont) {}
 
-        Stack(Stack &&other) noexcept : cont(std::move(other.cont)) {}
+        Stack(Stack &&other) noexcept(std::is_nothrow_move_constructible_v<Container>) : cont(std::move(other.cont)) {}
 
-        ~Stack() {
-            cont.clear();
-        }
+        ~Stack() = default;
 
         Stack &operator=(const Stack &other) {
             if (this != &other) {
-                cont.clear();
-                cont = Container(other.cont);
+                cont = other.cont;
             }
             return *this;
         }
 
-        Stack &operator=(Stack &&other) noexcept {
+        Stack &operator=(Stack &&other) noexcept(std::is_nothrow_move_assignable_v<Container>) {
             if (this != &other) {
-                cont = other.cont;
-                other.cont = Container();
+                cont = std::move(other.cont);
             }
             return *this;
         }
@@ -55,11 +59,48 @@ namespace st {
             cont.push_back(val);
         }
 
+        void push(T &&val) {
+            cont.push_back(std::move(val));
+        }
+
+        template<class... Args>
+        T &emplace(Args &&... args) {
+            return cont.emplace_back(std::forward<Args>(args)...);
+        }
+
+        // Pushes the elements of range in order, so its last element ends up on top.
+        template<std::ranges::input_range R>
+        void push_range(R &&range) {
+            if constexpr (std::ranges::sized_range<R> && requires(Container &c) { c.reserve(size_t{}); }) {
+                cont.reserve(cont.size() + std::ranges::size(range));
+            }
+            for (auto &&val: range) {
+                cont.emplace_back(std::forward<decltype(val)>(val));
+            }
+        }
+
+        // Moves up to n elements into out, top first. Returns how many were popped.
+        template<class OutputIt>
+        size_t pop_n(OutputIt out, size_t n) {
+            size_t count = 0;
+            for (; count < n && !cont.empty(); count++) {
+                *out = std::move(cont.back());
+                ++out;
+                cont.pop_back();
+            }
+            return count;
+        }
+
+        // Only for containers that can preallocate.
+        void reserve(size_t n) requires requires(Container &c) { c.reserve(n); } {
+            cont.reserve(n);
+        }
+
         void pop() {
             cont.pop_back();
         }
 
-        void swap(Stack &other) noexcept {
+        void swap(Stack &other) noexcept(noexcept(std::declval<Container &>().swap(std::declval<Container &>()))) {
             this->cont.swap(other.cont);
         }
 
@@ -1,5 +1,15 @@
 #include "stack.h"
+#include "concurrent_stack.h"
+#include "small_stack.h"
 #include <gtest/gtest.h>
+#include <atomic>
+#include <iterator>
+#include <list>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 class DqTest : public ::testing::Test {
 protected:
@@ -50,6 +60,237 @@ TEST(Constructors, Move) {
     }
 }
 
+TEST(AssignmentOperators, MoveLeavesSourceEmpty) {
+    st::Stack<int> s1;
+    for (int i = 0; i < 5000; i++) {
+        s1.push(i);
+    }
+    const int *top = &s1.top();
+    st::Stack<int> s2 = {1, 2};
+    s2 = std::move(s1);
+    EXPECT_TRUE(s1.empty());
+    EXPECT_EQ(&s2.top(), top);
+    s1.push(3);
+    EXPECT_EQ(s1.top(), 3);
+}
+
+TEST(Push, EmplaceAndMove) {
+    st::Stack<std::string> stack;
+    stack.emplace(3, 'a');
+    std::string s = "moved";
+    stack.push(std::move(s));
+    stack.push(std::string("temp"));
+    EXPECT_EQ(stack.size(), 3);
+    EXPECT_EQ(stack.top(), "temp");
+    stack.pop();
+    EXPECT_EQ(stack.top(), "moved");
+    stack.pop();
+    EXPECT_EQ(stack.top(), "aaa");
+}
+
+TEST(Push, ReserveKeepsTopInPlace) {
+    st::Stack<int> stack;
+    stack.reserve(100);
+    stack.push(0);
+    const int *bottom = &stack.top();
+    for (int i = 1; i < 100; i++) {
+        stack.push(i);
+    }
+    stack.pop();
+    for (int i = 98; i > 0; i--) {
+        stack.pop();
+    }
+    EXPECT_EQ(&stack.top(), bottom);
+}
+
+TEST(Push, DequeBackend) {
+    st::Stack<std::string, contDQ::Deque<std::string> > stack;
+    for (int i = 0; i < 1000; i++) {
+        stack.emplace(std::to_string(i));
+    }
+    st::Stack<std::string, contDQ::Deque<std::string> > copy = stack;
+    for (int i = 999; i >= 0; i--) {
+        ASSERT_EQ(copy.top(), std::to_string(i));
+        copy.pop();
+    }
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(stack.size(), 1000);
+}
+
+TEST(Concurrent, Lifo) {
+    st::ConcurrentStack<std::string> stack;
+    EXPECT_TRUE(stack.empty());
+    EXPECT_FALSE(stack.pop().has_value());
+    for (int i = 0; i < 100; i++) {
+        stack.push(std::to_string(i));
+    }
+    stack.emplace(2, 'x');
+    EXPECT_EQ(stack.pop(), "xx");
+    std::string out;
+    for (int i = 99; i >= 50; i--) {
+        ASSERT_TRUE(stack.try_pop(out));
+        ASSERT_EQ(out, std::to_string(i));
+    }
+    EXPECT_FALSE(stack.empty());
+}
+
+template<class S>
+void eachValuePoppedOnce() {
+    S stack;
+    const int threads = 8;
+    const int perThread = 20'000;
+    std::vector<std::atomic<int> > seen(threads * perThread);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&stack, &seen, t] {
+            for (int i = 0; i < perThread; i++) {
+                stack.push(t * perThread + i);
+                if (i % 2 == 1) {
+                    for (int k = 0; k < 2; k++) {
+                        if (auto val = stack.pop()) {
+                            seen[*val].fetch_add(1);
+                        }
+                    }
+                }
+            }
+        });
+    }
+    for (auto &w: workers) {
+        w.join();
+    }
+    while (auto val = stack.pop()) {
+        seen[*val].fetch_add(1);
+    }
+    for (auto &count: seen) {
+        ASSERT_EQ(count.load(), 1);
+    }
+}
+
+TEST(Concurrent, EachValuePoppedOnce) {
+    eachValuePoppedOnce<st::ConcurrentStack<int> >();
+    eachValuePoppedOnce<st::ConcurrentStack<int, std::allocator<int>, false> >();
+}
+
+TEST(Bulk, PushRangeAndPopN) {
+    st::Stack<int> stack = {1};
+    std::vector<int> in = {2, 3, 4, 5};
+    stack.push_range(in);
+    std::list<int> more = {6, 7};
+    stack.push_range(more);
+    EXPECT_EQ(stack.size(), 7);
+    std::vector<int> out;
+    EXPECT_EQ(stack.pop_n(std::back_inserter(out), 3), 3);
+    EXPECT_EQ(out, (std::vector<int>{7, 6, 5}));
+    EXPECT_EQ(stack.pop_n(std::back_inserter(out), 10), 4);
+    EXPECT_EQ(out, (std::vector<int>{7, 6, 5, 4, 3, 2, 1}));
+    EXPECT_TRUE(stack.empty());
+}
+
+TEST(Bulk, DequeBackendMovesOut) {
+    st::Stack<std::string, contDQ::Deque<std::string> > stack;
+    std::vector<std::string> in = {"a", "b", "c"};
+    stack.push_range(std::move(in));
+    std::string out[2];
+    EXPECT_EQ(stack.pop_n(out, 2), 2);
+    EXPECT_EQ(out[0], "c");
+    EXPECT_EQ(out[1], "b");
+    EXPECT_EQ(stack.top(), "a");
+}
+
+TEST(SmallStack, InlineThenSpill) {
+    st::SmallStack<std::string, 4> stack;
+    for (int i = 0; i < 4; i++) {
+        stack.push(std::to_string(i));
+    }
+    EXPECT_EQ(stack.size(), 4);
+    EXPECT_EQ(stack.top(), "3");
+    stack.push("4");
+    stack.emplace(2, '5');
+    EXPECT_EQ(stack.size(), 6);
+    st::SmallStack<std::string, 4> copy = stack;
+    st::SmallStack<std::string, 4> small = {"x"};
+    small.swap(copy);
+    EXPECT_EQ(small, stack);
+    EXPECT_EQ(copy.top(), "x");
+    for (int i = 4; i >= 0; i--) {
+        small.pop();
+        ASSERT_EQ(small.top(), std::to_string(i));
+    }
+    EXPECT_THROW(st::SmallStack<int>().pop(), std::out_of_range);
+}
+
+TEST(SmallStack, StaysInline) {
+    cont::SmallVector<int, 8> storage;
+    for (int i = 0; i < 8; i++) {
+        storage.push_back(i);
+    }
+    EXPECT_TRUE(storage.is_inline());
+    cont::SmallVector<int, 8> moved = std::move(storage);
+    EXPECT_TRUE(moved.is_inline());
+    EXPECT_EQ(moved.back(), 7);
+    EXPECT_TRUE(storage.empty());
+    moved.push_back(8);
+    EXPECT_FALSE(moved.is_inline());
+    EXPECT_EQ(moved.capacity(), 16);
+    storage = std::move(moved);
+    EXPECT_EQ(storage.back(), 8);
+    EXPECT_TRUE(moved.is_inline());
+    EXPECT_TRUE(moved < storage);
+}
+
+struct ThrowingMove {
+    int value = 0;
+
+    ThrowingMove() = default;
+
+    ThrowingMove(const ThrowingMove &other) = default;
+
+    ThrowingMove(ThrowingMove &&other) noexcept(false) : value(other.value) {
+    }
+
+    ThrowingMove &operator=(const ThrowingMove &other) = default;
+
+    ThrowingMove &operator=(ThrowingMove &&other) noexcept(false) {
+        value = other.value;
+        return *this;
+    }
+
+    bool operator==(const ThrowingMove &other) const = default;
+
+    auto operator<=>(const ThrowingMove &other) const = default;
+};
+
+TEST(SmallStack, MoveIsNoexceptOnlyWhenElementsAre) {
+    static_assert(std::is_nothrow_move_constructible_v<st::Stack<ThrowingMove> >);
+    static_assert(std::is_nothrow_move_constructible_v<st::SmallStack<int, 4> >);
+    static_assert(!std::is_nothrow_move_constructible_v<st::SmallStack<ThrowingMove, 4> >);
+    static_assert(!std::is_nothrow_move_assignable_v<st::SmallStack<ThrowingMove, 4> >);
+    static_assert(!noexcept(std::declval<st::SmallStack<ThrowingMove, 4> &>().swap(
+        std::declval<st::SmallStack<ThrowingMove, 4> &>())));
+    st::SmallStack<ThrowingMove, 4> stack;
+    stack.push(ThrowingMove());
+    st::SmallStack<ThrowingMove, 4> moved = std::move(stack);
+    EXPECT_EQ(moved.size(), 1);
+}
+
+TEST(SmallStack, CopyAssignBetweenSpilled) {
+    st::SmallStack<int, 2> a;
+    st::SmallStack<int, 2> b;
+    for (int i = 0; i < 10; i++) {
+        a.push(i);
+        b.push(i * 10);
+    }
+    a = b;
+    EXPECT_EQ(a, b);
+    a.push(1);
+    EXPECT_EQ(a.size(), 11);
+    EXPECT_EQ(b.top(), 90);
+    b = st::SmallStack<int, 2>{7};
+    a = b;
+    EXPECT_EQ(a.size(), 1);
+    EXPECT_EQ(a.top(), 7);
+}
+
 TEST(AssignmentOperators, CopyAssignment) {
     st::Stack<int> s1 = {5, 6, 7};
     st::Stack<int> s2;
@@ -0,0 +1,67 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "vector.h"
+
+template<class F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 10'000'000;
+    std::size_t rounds = argc > 2 ? std::stoull(argv[2]) : 10;
+    std::vector<int> src(count);
+    for (std::size_t i = 0; i < count; i++) {
+        src[i] = static_cast<int>(i);
+    }
+    long long sum = 0;
+
+    double pushLoop = timeIt([&] {
+        for (std::size_t r = 0; r < rounds; r++) {
+            cont::Vector<int> v;
+            for (int x: src) {
+                v.push_back(x);
+            }
+            sum += v.back();
+        }
+    });
+    double append = timeIt([&] {
+        for (std::size_t r = 0; r < rounds; r++) {
+            cont::Vector<int> v;
+            v.append_range(src);
+            sum += v.back();
+        }
+    });
+
+    // Front insertion of small batches: one memmove of the tail per batch.
+    std::size_t batches = 2000;
+    int batch[16] = {};
+    double frontSingle = timeIt([&] {
+        cont::Vector<int> v;
+        for (std::size_t b = 0; b < batches; b++) {
+            for (int x: batch) {
+                v.insert(0, x);
+            }
+        }
+        sum += static_cast<long long>(v.size());
+    });
+    double frontRange = timeIt([&] {
+        cont::Vector<int> v;
+        for (std::size_t b = 0; b < batches; b++) {
+            v.insert(0, batch, batch + 16);
+        }
+        sum += static_cast<long long>(v.size());
+    });
+
+    std::cout << "bulk load N=" << count << " x" << rounds
+            << ": push_back loop " << pushLoop << " ms, append_range " << append << " ms" << std::endl;
+    std::cout << "front insert " << batches << " batches of 16: one by one " << frontSingle
+            << " ms, range insert " << frontRange << " ms (" << sum << ")" << std::endl;
+    return 0;
+}
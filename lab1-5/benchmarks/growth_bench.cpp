@@ -0,0 +1,72 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <ratio>
+#include <string>
+#include <vector>
+#include "vector.h"
+
+struct AllocStats {
+    std::size_t allocations = 0;
+    std::size_t live = 0;
+    std::size_t peak = 0;
+};
+
+// Records allocation count, live bytes and peak bytes.
+template<class T>
+struct StatsAllocator {
+    using value_type = T;
+    AllocStats *stats;
+
+    explicit StatsAllocator(AllocStats *stats) : stats(stats) {
+    }
+
+    template<class U>
+    StatsAllocator(const StatsAllocator<U> &other) : stats(other.stats) {
+    }
+
+    T *allocate(std::size_t n) {
+        stats->allocations++;
+        stats->live += n * sizeof(T);
+        stats->peak = std::max(stats->peak, stats->live);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *ptr, std::size_t n) {
+        stats->live -= n * sizeof(T);
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    bool operator==(const StatsAllocator &other) const = default;
+};
+
+template<class V>
+void run(const char *name, std::size_t count) {
+    AllocStats stats;
+    long long sum = 0;
+    std::size_t capacity;
+    auto start = std::chrono::steady_clock::now();
+    {
+        V v{StatsAllocator<std::string>(&stats)};
+        for (std::size_t i = 0; i < count; i++) {
+            v.push_back(std::string(8, static_cast<char>('a' + i % 26)));
+        }
+        capacity = v.capacity();
+        sum += static_cast<long long>(v.size());
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << name << " N=" << count << ": "
+            << std::chrono::duration<double, std::milli>(end - start).count() << " ms, "
+            << stats.allocations << " allocations, capacity " << capacity
+            << ", peak " << stats.peak / 1024 << " KiB (" << sum << ")" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 1'000'000;
+    using Alloc = StatsAllocator<std::string>;
+    run<cont::Vector<std::string, Alloc> >("cont::Vector x2  ", count);
+    run<cont::Vector<std::string, Alloc, std::ratio<3, 2> > >("cont::Vector x1.5", count);
+    run<std::vector<std::string, Alloc> >("std::vector      ", count);
+    return 0;
+}
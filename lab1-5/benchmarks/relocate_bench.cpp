@@ -0,0 +1,80 @@
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "vector.h"
+
+template<bool OptIn>
+struct Handle {
+    std::unique_ptr<int> ptr;
+
+    explicit Handle(int v) : ptr(std::make_unique<int>(v)) {
+    }
+};
+
+template<>
+struct cont::is_trivially_relocatable<Handle<true> > : std::true_type {
+};
+
+template<class F>
+double timeIt(F f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+template<class V>
+double pushInts(std::size_t count, long long &sum) {
+    return timeIt([&] {
+        V v;
+        for (std::size_t i = 0; i < count; i++) {
+            v.push_back(static_cast<int>(i));
+        }
+        sum += v[count - 1];
+    });
+}
+
+// Grows an already large vector several times over, where each step copies everything
+// unless the block can be extended in place.
+template<class V>
+double growLarge(std::size_t count, long long &sum) {
+    V v;
+    for (std::size_t i = 0; i < count; i++) {
+        v.push_back(static_cast<int>(i));
+    }
+    return timeIt([&] {
+        for (std::size_t c = count * 2; c <= count * 16; c *= 2) {
+            v.reserve(c);
+        }
+        sum += v[count - 1];
+    });
+}
+
+template<class H>
+double pushHandles(std::size_t count, long long &sum) {
+    return timeIt([&] {
+        cont::Vector<H> v;
+        for (std::size_t i = 0; i < count; i++) {
+            v.emplace_back(static_cast<int>(i));
+        }
+        sum += *v[count - 1].ptr;
+    });
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 10'000'000;
+    long long sum = 0;
+    std::cout << "push_back " << count << " ints: cont::Vector " << pushInts<cont::Vector<int> >(count, sum)
+            << " ms, std::vector " << pushInts<std::vector<int> >(count, sum) << " ms" << std::endl;
+    std::cout << "grow " << count << " ints 2x..16x: cont::Vector " << growLarge<cont::Vector<int> >(count, sum)
+            << " ms, std::vector " << growLarge<std::vector<int> >(count, sum) << " ms" << std::endl;
+    std::size_t handles = count / 10;
+    std::cout << "emplace_back " << handles << " unique_ptr holders: relocatable "
+            << pushHandles<Handle<true> >(handles, sum) << " ms, move-constructed "
+            << pushHandles<Handle<false> >(handles, sum) << " ms (" << sum << ")" << std::endl;
+    return 0;
+}
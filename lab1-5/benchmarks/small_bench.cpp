@@ -0,0 +1,53 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "vector.h"
+#include "../tests/counting_allocator.h"
+
+// Builds one short-lived vector per entry of sizes and fills it to that size, the way
+// parsers and graph code build one per token or per node. V counts through CountingAllocator's
+// global stats: with plain std::allocator, cont::Vector<int> would use malloc/realloc unseen.
+template<class V>
+void run(const char *name, const std::vector<int> &sizes) {
+    long long sum = 0;
+    std::size_t before = globalAllocationStats().calls;
+    auto start = std::chrono::steady_clock::now();
+    for (int size: sizes) {
+        V v;
+        for (int i = 0; i < size; i++) {
+            v.push_back(i);
+        }
+        for (int i = 0; i < size; i++) {
+            sum += v[i];
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::cout << name << std::chrono::duration<double, std::milli>(end - start).count() << " ms, "
+            << static_cast<double>(globalAllocationStats().calls - before) / static_cast<double>(sizes.size())
+            << " allocations per vector (" << sum << ")" << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::size_t count = argc > 1 ? std::stoull(argv[1]) : 1'000'000;
+    std::minstd_rand rng(42);
+    // Mostly small: geometric sizes with mean 4, and a fixed size well past the inline buffer.
+    std::geometric_distribution<int> typical(0.2);
+    std::vector<int> shapes[3];
+    for (std::size_t i = 0; i < count; i++) {
+        shapes[0].push_back(std::min(typical(rng), 15));
+        shapes[1].push_back(typical(rng));
+        shapes[2].push_back(64);
+    }
+    const char *labels[] = {"sizes < 16 ", "geometric  ", "64 elements"};
+    for (int s = 0; s < 3; s++) {
+        std::cout << labels[s] << ":" << std::endl;
+        run<std::vector<int, CountingAllocator<int> > >("  std::vector         ", shapes[s]);
+        run<cont::Vector<int, CountingAllocator<int> > >("  Vector              ", shapes[s]);
+        run<cont::SmallVector<int, 16, CountingAllocator<int> > >("  SmallVector<16>     ", shapes[s]);
+    }
+    return 0;
+}
@@ -1,108 +1,350 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 
+#include "../../lab1-1/include/container.h"
 #include <iostream>
 #include <compare>
+#include <concepts>
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <ratio>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace cont {
+    // A type is trivially relocatable when moving an object to a new address and not running its
+    // destructor at the old one is the same as a bitwise copy. True for trivially copyable types;
+    // other types (e.g. ones holding a unique_ptr) may opt in by specializing this trait.
     template<class T>
-    class MyContainer {
-    public:
-        MyContainer() = default;
-
-        MyContainer(const MyContainer &other) = default;
-
-        virtual ~MyContainer() = default;
+    struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T> > {
+    };
 
-        MyContainer &operator=(const MyContainer &other) = default;
+    template<class T>
+    inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
 
-        virtual bool operator==(const MyContainer &other) const = 0;
+    // Raw room for N elements kept inside the vector object itself.
+    template<class T, std::size_t N>
+    struct InlineBuffer {
+        alignas(T) unsigned char bytes[N * sizeof(T)];
 
-        virtual bool operator!=(const MyContainer &other) const = 0;
+        T *data() {
+            return reinterpret_cast<T *>(bytes);
+        }
 
-        [[nodiscard]] virtual std::size_t size() const = 0;
+        const T *data() const {
+            return reinterpret_cast<const T *>(bytes);
+        }
+    };
 
-        [[nodiscard]] virtual std::size_t max_size() const = 0;
+    template<class T>
+    struct InlineBuffer<T, 0> {
+        T *data() {
+            return nullptr;
+        }
 
-        [[nodiscard]] virtual bool empty() const = 0;
+        const T *data() const {
+            return nullptr;
+        }
     };
 
-    template<class T, class Allocator = std::allocator<T> >
-    class Vector {
+    // GrowthFactor is the std::ratio by which capacity grows when push_back runs out of room.
+    // 2 (the default) means fewer reallocations. 3/2 lets freed blocks be reused sooner and
+    // wastes less memory. The first InlineCapacity elements live inside the object and need no
+    // allocation at all (see SmallVector); with 0, the default, an empty vector holds nullptr.
+    template<class T, class Allocator = std::allocator<T>, class GrowthFactor = std::ratio<2>,
+        std::size_t InlineCapacity = 0>
+    class Vector : public ContainerBase<Vector<T, Allocator, GrowthFactor, InlineCapacity> > {
+        static_assert(std::ratio_greater_v<GrowthFactor, std::ratio<1> >, "Vector growth factor must exceed 1");
+
     private:
         using siz = std::size_t;
-        T *data_ = nullptr;
+        using AllocTraits = std::allocator_traits<Allocator>;
+        static constexpr siz N = InlineCapacity;
+        // Moving or swapping a vector whose elements sit in the inline buffer moves them one by one.
+        static constexpr bool NothrowSteal = N == 0 || std::is_nothrow_move_constructible_v<T>;
+        [[no_unique_address]] InlineBuffer<T, N> buffer;
+        T *data_ = buffer.data();
         siz len = 0;
-        siz cap = 0;
-        Allocator alloc = Allocator();
+        siz cap = N;
+        [[no_unique_address]] Allocator alloc = Allocator();
+
+        siz grownCapacity(siz needed) const {
+            siz grown = cap * GrowthFactor::num / GrowthFactor::den;
+            return std::max({grown, cap + 1, needed});
+        }
+
+        static constexpr bool Relocatable = is_trivially_relocatable_v<T>;
+        // With the default allocator, relocatable elements live in malloc/mmap memory so that
+        // growth can extend the block in place with realloc/mremap instead of copying.
+        static constexpr bool RawMemory = Relocatable && std::is_same_v<Allocator, std::allocator<T> >
+                                          && alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+#ifdef __linux__
+        // Blocks of at least this many bytes are mapped directly and grown with mremap, which
+        // moves page tables instead of bytes.
+        static constexpr siz MremapThreshold = siz{1} << 20;
+
+        static bool isMapped(siz n) {
+            return n * sizeof(T) >= MremapThreshold;
+        }
+
+        static siz mappedBytes(siz n) {
+            static const siz page = static_cast<siz>(sysconf(_SC_PAGESIZE));
+            return (n * sizeof(T) + page - 1) / page * page;
+        }
+#else
+        static bool isMapped(siz) {
+            return false;
+        }
+#endif
+
+        T *allocateBlock(siz n) {
+            if constexpr (RawMemory) {
+                void *ptr;
+#ifdef __linux__
+                if (isMapped(n)) {
+                    ptr = mmap(nullptr, mappedBytes(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                    if (ptr == MAP_FAILED) {
+                        throw std::bad_alloc();
+                    }
+                    return static_cast<T *>(ptr);
+                }
+#endif
+                ptr = std::malloc(n * sizeof(T));
+                if (ptr == nullptr) {
+                    throw std::bad_alloc();
+                }
+                return static_cast<T *>(ptr);
+            } else {
+                return AllocTraits::allocate(alloc, n);
+            }
+        }
+
+        void freeBlock(T *ptr, siz n) noexcept {
+            if constexpr (RawMemory) {
+#ifdef __linux__
+                if (isMapped(n)) {
+                    munmap(ptr, mappedBytes(n));
+                    return;
+                }
+#endif
+                std::free(ptr);
+            } else {
+                AllocTraits::deallocate(alloc, ptr, n);
+            }
+        }
+
+        // RawMemory only: resizes the block holding len elements, moving bytes only if the
+        // block cannot be extended where it is.
+        T *resizeBlock(T *ptr, siz oldCap, siz newCap) {
+            void *resized = nullptr;
+#ifdef __linux__
+            if (isMapped(oldCap) && isMapped(newCap)) {
+                resized = mremap(ptr, mappedBytes(oldCap), mappedBytes(newCap), MREMAP_MAYMOVE);
+                if (resized == MAP_FAILED) {
+                    throw std::bad_alloc();
+                }
+                return static_cast<T *>(resized);
+            }
+#endif
+            if (!isMapped(oldCap) && !isMapped(newCap)) {
+                resized = std::realloc(static_cast<void *>(ptr), newCap * sizeof(T));
+                if (resized == nullptr) {
+                    throw std::bad_alloc();
+                }
+                return static_cast<T *>(resized);
+            }
+            T *fresh = allocateBlock(newCap);
+            std::memcpy(static_cast<void *>(fresh), static_cast<const void *>(ptr), len * sizeof(T));
+            freeBlock(ptr, oldCap);
+            return fresh;
+        }
+
+        // Blocks of up to N elements are the inline buffer.
+        T *allocateExact(siz n) {
+            return n <= N ? buffer.data() : allocateBlock(n);
+        }
+
+        void releaseExact(T *ptr, siz n) noexcept {
+            if (ptr != buffer.data()) {
+                freeBlock(ptr, n);
+            }
+        }
+
+        // Moves (or copies, if moving may throw and copying is possible) the elements into a
+        // block of exactly newCap. Trivially relocatable elements are moved bitwise, in place
+        // when the block can grow. On exception the vector is left unchanged.
+        void relocate(siz newCap) {
+            if constexpr (Relocatable) {
+                if constexpr (RawMemory) {
+                    if (data_ != buffer.data() && newCap > N) {
+                        data_ = resizeBlock(data_, cap, newCap);
+                        cap = newCap;
+                        return;
+                    }
+                }
+                T *newData = allocateExact(newCap);
+                if (newData == data_) {
+                    return;
+                }
+                if (len > 0) {
+                    std::memcpy(static_cast<void *>(newData), static_cast<const void *>(data_), len * sizeof(T));
+                }
+                releaseExact(data_, cap);
+                data_ = newData;
+                cap = std::max(newCap, N);
+                return;
+            }
+            T *newData = allocateExact(newCap);
+            if (newData == data_) {
+                return;
+            }
+            try {
+                if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                    std::uninitialized_move(data_, data_ + len, newData);
+                } else {
+                    std::uninitialized_copy(data_, data_ + len, newData);
+                }
+            } catch (...) {
+                releaseExact(newData, newCap);
+                throw;
+            }
+            deallocateAll();
+            data_ = newData;
+            cap = std::max(newCap, N);
+        }
+
+        // Destroys the elements and frees the block; len is kept for the caller to reset.
+        void deallocateAll() noexcept {
+            std::destroy(data_, data_ + len);
+            releaseExact(data_, cap);
+        }
+
+        // Inserts n elements copied from the contiguous run src at index with at most one
+        // reallocation (itself a realloc where possible); the tail moves with one memmove,
+        // the new elements with one memcpy.
+        void insertTrivial(siz index, const T *src, siz n) {
+            if (n == 0) {
+                return;
+            }
+            // std::less gives a total order even over pointers into unrelated objects.
+            std::less<const T *> before;
+            if (before(data_, src + n) && before(src, data_ + len)) {
+                // The source lives in this vector and would move under us.
+                Vector copy(alloc);
+                copy.reserve(n);
+                std::memcpy(static_cast<void *>(copy.data_), src, n * sizeof(T));
+                copy.len = n;
+                insertTrivial(index, copy.data_, n);
+                return;
+            }
+            if (len + n > cap) {
+                relocate(grownCapacity(len + n));
+            }
+            if (index < len) {
+                std::memmove(static_cast<void *>(data_ + index + n), data_ + index, (len - index) * sizeof(T));
+            }
+            std::memcpy(static_cast<void *>(data_ + index), src, n * sizeof(T));
+            len += n;
+        }
+
+        // Leaves other empty and back on its own inline buffer.
+        void stealFrom(Vector &other) noexcept(NothrowSteal) {
+            if (other.data_ != other.buffer.data()) {
+                data_ = std::exchange(other.data_, other.buffer.data());
+                len = std::exchange(other.len, 0);
+                cap = std::exchange(other.cap, N);
+                return;
+            }
+            data_ = buffer.data();
+            cap = N;
+            len = 0;
+            // Without an inline buffer other is empty here and there is nothing to move.
+            if constexpr (N > 0) {
+                std::uninitialized_move(other.data_, other.data_ + other.len, data_);
+                len = std::exchange(other.len, 0);
+                std::destroy(other.data_, other.data_ + len);
+            }
+        }
 
     public:
+        using value_type = T;
+        using allocator_type = Allocator;
+
         Vector() = default;
 
-        explicit Vector(siz n, T val = 0) {
-            data_ = alloc.allocate(n * sizeof(T));
-            cap = n;
-            len = n;
-            for (siz i = 0; i < n; i++) {
-                data_[i] = val;
+        explicit Vector(const Allocator &alloc) : alloc(alloc) {
+        }
+
+        explicit Vector(siz n, const T &val = T()) {
+            data_ = allocateExact(n);
+            cap = std::max<siz>(n, N);
+            try {
+                std::uninitialized_fill_n(data_, n, val);
+            } catch (...) {
+                releaseExact(data_, cap);
+                throw;
             }
+            len = n;
         }
 
         Vector(std::initializer_list<T> init) {
-            data_ = alloc.allocate(init.size() * sizeof(T));
-            std::copy(init.begin(), init.end(), data_);
+            data_ = allocateExact(init.size());
+            cap = std::max<siz>(init.size(), N);
+            try {
+                std::uninitialized_copy(init.begin(), init.end(), data_);
+            } catch (...) {
+                releaseExact(data_, cap);
+                throw;
+            }
             len = init.size();
-            cap = init.size();
         }
 
-        Vector(const Vector &other) {
-            alloc = other.alloc;
-            data_ = alloc.allocate(other.cap * sizeof(T));
-            std::copy(other.data_, other.data_ + other.cap, data_);
+        Vector(const Vector &other) : alloc(AllocTraits::select_on_container_copy_construction(other.alloc)) {
+            data_ = allocateExact(other.len);
+            cap = std::max<siz>(other.len, N);
+            try {
+                std::uninitialized_copy(other.data_, other.data_ + other.len, data_);
+            } catch (...) {
+                releaseExact(data_, cap);
+                throw;
+            }
             len = other.len;
-            cap = other.cap;
         }
 
-        Vector(Vector &&other) noexcept {
-            alloc = other.alloc;
-            data_ = other.data_;
-            len = other.len;
-            cap = other.cap;
-            other.data_ = nullptr;
-            other.len = 0;
-            other.cap = 0;
-            other.data_ = nullptr;
+        Vector(Vector &&other) noexcept(NothrowSteal) : alloc(std::move(other.alloc)) {
+            stealFrom(other);
         }
 
         ~Vector() {
-            if (data_ != nullptr) {
-                alloc.deallocate(data_, cap * sizeof(T));
-            }
+            deallocateAll();
         }
 
         Vector &operator=(const Vector &other) {
             if (this != &other) {
-                if (data_ != nullptr) {
-                    alloc.deallocate(data_, cap * sizeof(T));
-                }
-                alloc = other.alloc;
-                len = other.len;
-                cap = other.cap;
-                data_ = alloc.allocate(other.cap * sizeof(T));
-                std::copy(other.data_, other.data_ + other.cap, data_);
+                Vector tmp(other);
+                swap(tmp);
             }
             return *this;
         }
 
-        Vector &operator=(Vector &&other) noexcept {
+        Vector &operator=(Vector &&other) noexcept(NothrowSteal) {
             if (this != &other) {
-                data_ = other.data_;
-                alloc = other.alloc;
-                len = other.len;
-                cap = other.cap;
-                other.data_ = nullptr;
-                other.len = 0;
-                other.cap = 0;
+                deallocateAll();
+                alloc = std::move(other.alloc);
+                stealFrom(other);
             }
             return *this;
         }
@@ -136,126 +378,168 @@ namespace cont {
             return data_;
         }
 
-        [[nodiscard]] bool empty() const {
-            return len == 0;
-        }
-
         [[nodiscard]] siz size() const {
             return len;
         }
 
+        [[nodiscard]] siz max_size() const {
+            return AllocTraits::max_size(alloc);
+        }
+
         [[nodiscard]] siz capacity() const {
             return cap;
         }
 
+        // True while no heap memory is in use.
+        [[nodiscard]] bool is_inline() const {
+            return data_ == buffer.data();
+        }
+
         void reserve(siz n) {
             if (n <= cap) {
                 return;
             }
-            T* new_data = alloc.allocate(n * sizeof(T));
-            std::copy(data_, data_ + len, new_data);
-            alloc.deallocate(data_, cap * sizeof(T));
-            data_ = new_data;
-            cap = n;
+            relocate(n);
         }
 
         void shrink_to_fit() {
-            T* new_data = alloc.allocate(len * sizeof(T));
-            std::copy(data_, data_ + len, new_data);
-            alloc.deallocate(data_, cap * sizeof(T));
-            data_ = new_data;
-            cap = len;
+            if (len < cap) {
+                relocate(len);
+            }
         }
 
         void clear() {
             if (len == 0) {
                 throw(std::out_of_range("The vector is empty."));
             }
-            for (siz i = 0; i < len; i++) {
-                data_[i].~T();
-            }
+            std::destroy(data_, data_ + len);
             len = 0;
         }
 
-        void push_back(T val) {
+        template<class... Args>
+        T& emplace_back(Args &&... args) {
             if (len == cap) {
-                if (cap == 0) {
-                    reserve(1);
-                } else {
-                    reserve(cap * 2);
-                }
+                // Build the element first: args may refer to an element that relocate() moves.
+                T tmp(std::forward<Args>(args)...);
+                relocate(grownCapacity(len + 1));
+                std::construct_at(data_ + len, std::move(tmp));
+            } else {
+                std::construct_at(data_ + len, std::forward<Args>(args)...);
             }
-            data_[len] = val;
-            len++;
+            return data_[len++];
+        }
+
+        void push_back(const T &val) {
+            emplace_back(val);
+        }
+
+        void push_back(T &&val) {
+            emplace_back(std::move(val));
         }
 
         void pop_back() {
             if (len == 0) {
                 throw std::out_of_range("Popped empty vector.");
             }
-            std::allocator_traits<decltype(alloc)>::destroy(alloc, &data_[len - 1]);
+            std::destroy_at(data_ + len - 1);
             len--;
         }
 
+        // Inserting past the end pads the gap with value-initialized elements.
         void insert(siz index, T val) {
-            if (len == cap) {
-                if (cap == 0) {
-                    reserve(index + 1);
-                    len = cap;
-                } else {
-                    reserve(cap * 2);
-                    len++;
+            if (index > len) {
+                resize(index);
+            }
+            emplace(index, std::move(val));
+        }
+
+        // Inserts [first, last) before index. Forward ranges reserve once; trivially copyable
+        // elements from a contiguous range are placed with memmove/memcpy.
+        template<std::input_iterator It>
+        void insert(siz index, It first, It last) {
+            if (index > len) {
+                throw std::out_of_range("Insert index out of range.");
+            }
+            if constexpr (std::is_trivially_copyable_v<T> && std::contiguous_iterator<It>
+                          && std::is_same_v<std::remove_cv_t<std::iter_value_t<It> >, T>) {
+                insertTrivial(index, std::to_address(first), static_cast<siz>(last - first));
+            } else {
+                siz oldLen = len;
+                if constexpr (std::forward_iterator<It>) {
+                    siz n = static_cast<siz>(std::distance(first, last));
+                    if (len + n > cap) {
+                        relocate(grownCapacity(len + n));
+                    }
+                }
+                for (; first != last; ++first) {
+                    emplace_back(*first);
                 }
+                std::rotate(data_ + index, data_ + oldLen, data_ + len);
             }
-            for (siz i = len; i > index; --i) {
-                data_[i] = data_[i - 1];
+        }
+
+        template<std::ranges::input_range R>
+        void append_range(R &&range) {
+            if constexpr (std::ranges::common_range<R>) {
+                insert(len, std::ranges::begin(range), std::ranges::end(range));
+            } else {
+                for (auto &&val: range) {
+                    emplace_back(std::forward<decltype(val)>(val));
+                }
+            }
+        }
+
+        // Constructs the element in place of index, shifting the tail right by one.
+        template<class... Args>
+        T& emplace(siz index, Args &&... args) {
+            if (index > len) {
+                throw std::out_of_range("Emplace index out of range.");
             }
-            data_[index] = val;
+            if (index == len) {
+                return emplace_back(std::forward<Args>(args)...);
+            }
+            T tmp(std::forward<Args>(args)...);
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                insertTrivial(index, std::addressof(tmp), 1);
+            } else {
+                emplace_back(std::move(data_[len - 1]));
+                std::move_backward(data_ + index, data_ + len - 2, data_ + len - 1);
+                data_[index] = std::move(tmp);
+            }
+            return data_[index];
         }
 
         void erase(siz index) {
             if (index >= len) {
                 throw std::out_of_range("Erase index out of range.");
             }
-            std::allocator_traits<decltype(alloc)>::destroy(alloc, &data_[index]);
-            for (siz i = index; i < len - 1; ++i) {
-                data_[i] = data_[i + 1];
-            }
-            len--;
+            std::move(data_ + index + 1, data_ + len, data_ + index);
+            pop_back();
         }
 
         void resize(siz new_size) {
-            if (new_size > cap) {
-                reserve(new_size);
-            }
             if (new_size > len) {
-                for (size_t i = len; i < new_size; ++i) {
-                    data_[i] = 0;
-                }
-            } else if (new_size < len) {
-                for (size_t i = new_size; i < len; ++i) {
-                    data_[i].~T();
-                }
+                reserve(new_size);
+                std::uninitialized_value_construct(data_ + len, data_ + new_size);
+            } else {
+                std::destroy(data_ + new_size, data_ + len);
             }
             len = new_size;
         }
 
-        void swap(Vector &other) noexcept {
-            Allocator tmpAlloc = alloc;
-            alloc = other.alloc;
-            other.alloc = tmpAlloc;
-
-            T* tmpData = data_;
-            data_ = other.data_;
-            other.data_ = tmpData;
-
-            siz tmpLen = len;
-            len = other.len;
-            other.len = tmpLen;
-
-            siz tmpCap = cap;
-            cap = other.cap;
-            other.cap = tmpCap;
+        void swap(Vector &other) noexcept(NothrowSteal) {
+            if constexpr (N > 0) {
+                // Inline elements cannot trade places by swapping pointers.
+                Vector tmp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(tmp);
+            } else {
+                using std::swap;
+                swap(alloc, other.alloc);
+                swap(data_, other.data_);
+                swap(len, other.len);
+                swap(cap, other.cap);
+            }
         }
 
         bool operator==(const Vector &other) const {
@@ -270,10 +554,6 @@ namespace cont {
             return true;
         }
 
-        bool operator!=(const Vector &other) const {
-            return !(*this == other);
-        }
-
         std::strong_ordering operator<=>(const Vector& other) const {
             size_t min_size = (len < other.len) ? len : other.len;
 
@@ -286,6 +566,11 @@ namespace cont {
             return len <=> other.len;
         }
     };
+
+    // Vector that keeps its first N elements inside the object and allocates only once it
+    // outgrows them, for the many vectors that stay small.
+    template<class T, std::size_t N, class Allocator = std::allocator<T> >
+    using SmallVector = Vector<T, Allocator, std::ratio<2>, N>;
 }
 
-#endif //VECTOR_H
\ No newline at end of file
+#endif //VECTOR_H
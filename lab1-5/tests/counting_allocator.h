@@ -0,0 +1,53 @@
+#ifndef COUNTING_ALLOCATOR_H
+#define COUNTING_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+
+// What a CountingAllocator has handed out; copies and rebinds of one allocator share it.
+struct AllocationStats {
+    std::size_t calls = 0;
+    std::size_t bytes = 0;
+    std::size_t live = 0;
+};
+
+// Shared by allocators constructed without stats of their own.
+inline AllocationStats &globalAllocationStats() {
+    static AllocationStats stats;
+    return stats;
+}
+
+// Forwards to std::allocator and records every allocation, for tests and benchmarks that check
+// how often and how much a container allocates.
+template<class T>
+struct CountingAllocator {
+    using value_type = T;
+
+    AllocationStats *stats;
+
+    explicit CountingAllocator(AllocationStats *stats = &globalAllocationStats()) : stats(stats) {
+    }
+
+    template<class U>
+    CountingAllocator(const CountingAllocator<U> &other) : stats(other.stats) {
+    }
+
+    T *allocate(std::size_t n) {
+        stats->calls++;
+        stats->bytes += n * sizeof(T);
+        stats->live += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *ptr, std::size_t n) {
+        stats->live -= n * sizeof(T);
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template<class U>
+    bool operator==(const CountingAllocator<U> &other) const {
+        return stats == other.stats;
+    }
+};
+
+#endif //COUNTING_ALLOCATOR_H
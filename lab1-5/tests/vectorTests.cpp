@@ -1,5 +1,12 @@
 #include "vector.h"
+#include "counting_allocator.h"
 #include <gtest/gtest.h>
+#include <list>
+#include <ranges>
+#include <vector>
+#include <cstddef>
+#include <memory>
+#include <string>
 
 TEST(Constructors, DefaultConstructor) {
     cont::Vector<int> v;
@@ -229,6 +236,357 @@ TEST(Compare, SpaceshipOperatorEqualBySize) {
     EXPECT_TRUE((v1 < v2));
 }
 
+TEST(Interface, StaticContainer) {
+    static_assert(cont::Container<cont::Vector<int> >);
+    static_assert(!std::is_polymorphic_v<cont::Vector<int> >);
+    cont::Vector<int> v;
+    EXPECT_GT(v.max_size(), 0);
+}
+
+TEST(Interface, PolymorphicContainer) {
+    cont::PolymorphicContainer<cont::Vector<int> > a = {1, 2, 3};
+    cont::PolymorphicContainer<cont::Vector<int> > b = {1, 2, 3};
+    const cont::MyContainer<int> &base = b;
+    EXPECT_TRUE(a == base);
+    b.push_back(4);
+    EXPECT_TRUE(a != base);
+    EXPECT_EQ(base.size(), 4);
+}
+
+TEST(Storage, ExactAllocation) {
+    using Counted = cont::Vector<std::string, CountingAllocator<std::string> >;
+    constexpr std::size_t item = sizeof(std::string);
+    AllocationStats stats;
+    {
+        Counted v{CountingAllocator<std::string>(&stats)};
+        EXPECT_EQ(stats.calls, 0);
+        for (int i = 0; i < 10; i++) {
+            v.push_back(std::to_string(i));
+        }
+        EXPECT_EQ(stats.bytes, (1 + 2 + 4 + 8 + 16) * item);
+        EXPECT_EQ(stats.live, 16 * item);
+        v.shrink_to_fit();
+        EXPECT_EQ(stats.live, 10 * item);
+        Counted copy = v;
+        EXPECT_EQ(stats.live, 20 * item);
+        v.reserve(100);
+        EXPECT_EQ(stats.live, 110 * item);
+    }
+    EXPECT_EQ(stats.live, 0);
+}
+
+TEST(Storage, NonTrivialElements) {
+    cont::Vector<std::string> v;
+    for (int i = 0; i < 100; i++) {
+        v.push_back(std::string(20, static_cast<char>('a' + i % 26)));
+    }
+    v.insert(0, "front");
+    v.insert(50, "middle");
+    v.erase(1);
+    EXPECT_EQ(v.size(), 101);
+    EXPECT_EQ(v[0], "front");
+    EXPECT_EQ(v[49], "middle");
+    cont::Vector<std::string> copy = v;
+    EXPECT_EQ(copy, v);
+    EXPECT_EQ(copy.capacity(), copy.size());
+    copy.resize(3);
+    copy.resize(5);
+    EXPECT_EQ(copy[4], "");
+    copy.shrink_to_fit();
+    v = copy;
+    EXPECT_EQ(v.size(), 5);
+    v.push_back(v[0]);
+    EXPECT_EQ(v.back(), "front");
+}
+
+struct ThrowingMove {
+    int value;
+    static inline int copies = 0;
+
+    explicit ThrowingMove(int value) : value(value) {
+    }
+
+    ThrowingMove(const ThrowingMove &other) : value(other.value) {
+        copies++;
+    }
+
+    ThrowingMove(ThrowingMove &&other) noexcept(false) : value(other.value) {
+    }
+
+    ThrowingMove &operator=(const ThrowingMove &other) = default;
+
+    bool operator==(const ThrowingMove &other) const = default;
+
+    auto operator<=>(const ThrowingMove &other) const = default;
+};
+
+TEST(Storage, CopiesWhenMoveMayThrow) {
+    cont::Vector<ThrowingMove> v;
+    v.reserve(2);
+    v.emplace_back(1);
+    v.emplace_back(2);
+    ThrowingMove::copies = 0;
+    v.reserve(10);
+    EXPECT_EQ(ThrowingMove::copies, 2);
+    EXPECT_EQ(v[1].value, 2);
+}
+
+TEST(Storage, GrowthFactor) {
+    cont::Vector<int> doubling;
+    cont::Vector<int, std::allocator<int>, std::ratio<3, 2> > halfAgain;
+    std::size_t lastDoubling = 0;
+    std::size_t lastHalf = 0;
+    for (int i = 0; i < 1000; i++) {
+        doubling.push_back(i);
+        halfAgain.push_back(i);
+        if (doubling.capacity() != lastDoubling) {
+            EXPECT_TRUE(lastDoubling == 0 || doubling.capacity() == lastDoubling * 2);
+            lastDoubling = doubling.capacity();
+        }
+        if (halfAgain.capacity() != lastHalf) {
+            EXPECT_TRUE(lastHalf < 2 || halfAgain.capacity() == lastHalf * 3 / 2);
+            lastHalf = halfAgain.capacity();
+        }
+    }
+    EXPECT_EQ(doubling.capacity(), 1024);
+    EXPECT_GE(halfAgain.capacity(), 1000);
+    EXPECT_EQ(halfAgain[999], 999);
+}
+
+TEST(Bulk, AppendRangeAllocatesOnce) {
+    AllocationStats stats;
+    cont::Vector<int, CountingAllocator<int> > v{CountingAllocator<int>(&stats)};
+    std::vector<int> src(1000);
+    for (int i = 0; i < 1000; i++) {
+        src[i] = i;
+    }
+    v.append_range(src);
+    EXPECT_EQ(v.size(), 1000);
+    EXPECT_EQ(stats.calls, 1);
+    EXPECT_EQ(stats.bytes, 1000 * sizeof(int));
+    EXPECT_EQ(v[999], 999);
+    v.append_range(std::views::iota(0, 3));
+    EXPECT_EQ(v.size(), 1003);
+    EXPECT_EQ(v.back(), 2);
+}
+
+TEST(Bulk, InsertRange) {
+    cont::Vector<int> v = {1, 2, 7, 8};
+    int mid[] = {3, 4, 5, 6};
+    v.insert(2, mid, mid + 4);
+    EXPECT_EQ(v, (cont::Vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+    v.insert(0, v.data() + 6, v.data() + 8);
+    EXPECT_EQ(v, (cont::Vector<int>{7, 8, 1, 2, 3, 4, 5, 6, 7, 8}));
+    v.insert(3, v.data() + 2, v.data() + 2);
+    EXPECT_EQ(v.size(), 10);
+    EXPECT_THROW(v.insert(11, mid, mid + 1), std::out_of_range);
+
+    cont::Vector<std::string> s = {"a", "d"};
+    std::list<std::string> more = {"b", "c"};
+    s.insert(1, more.begin(), more.end());
+    EXPECT_EQ(s, (cont::Vector<std::string>{"a", "b", "c", "d"}));
+    s.append_range(more);
+    EXPECT_EQ(s.size(), 6);
+    EXPECT_EQ(s[5], "c");
+}
+
+TEST(Bulk, Emplace) {
+    cont::Vector<std::string> s = {"a", "c"};
+    EXPECT_EQ(s.emplace(1, 1, 'b'), "b");
+    EXPECT_EQ(s.emplace(3, "d"), "d");
+    EXPECT_EQ(s, (cont::Vector<std::string>{"a", "b", "c", "d"}));
+    cont::Vector<int> v = {1, 3};
+    v.emplace(1, 2);
+    v.emplace(0, 0);
+    EXPECT_EQ(v, (cont::Vector<int>{0, 1, 2, 3}));
+    EXPECT_THROW(v.emplace(5, 0), std::out_of_range);
+}
+
+struct Owned {
+    std::unique_ptr<int> value;
+    static inline int moves = 0;
+    static inline int destroyed = 0;
+
+    explicit Owned(int v) : value(std::make_unique<int>(v)) {
+    }
+
+    Owned(Owned &&other) noexcept : value(std::move(other.value)) {
+        moves++;
+    }
+
+    Owned &operator=(Owned &&other) noexcept = default;
+
+    ~Owned() {
+        destroyed++;
+    }
+
+    bool operator==(const Owned &other) const {
+        return *value == *other.value;
+    }
+
+    std::strong_ordering operator<=>(const Owned &other) const {
+        return *value <=> *other.value;
+    }
+};
+
+template<>
+struct cont::is_trivially_relocatable<Owned> : std::true_type {
+};
+
+TEST(Relocation, OptInSkipsMoves) {
+    {
+        cont::Vector<Owned> v;
+        v.reserve(4);
+        for (int i = 0; i < 4; i++) {
+            v.emplace_back(i);
+        }
+        Owned::moves = 0;
+        Owned::destroyed = 0;
+        v.reserve(1000);
+        v.shrink_to_fit();
+        EXPECT_EQ(Owned::moves, 0);
+        EXPECT_EQ(Owned::destroyed, 0);
+        EXPECT_EQ(*v[3].value, 3);
+    }
+    EXPECT_EQ(Owned::destroyed, 4);
+}
+
+TEST(Relocation, LargeBlocksCrossMappingThreshold) {
+    cont::Vector<long long> v;
+    const long long n = 1'000'000;
+    for (long long i = 0; i < n; i++) {
+        v.push_back(i);
+    }
+    v.reserve(3'000'000);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), static_cast<std::size_t>(n));
+    cont::Vector<long long> copy = v;
+    EXPECT_EQ(copy, v);
+    v.resize(10);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.capacity(), 10);
+    EXPECT_EQ(v[9], 9);
+    EXPECT_EQ(copy[n - 1], n - 1);
+}
+
+// Behaviour every Vector flavour must share, run across the inline/heap boundary.
+template<class V>
+class SharedApi : public ::testing::Test {
+};
+
+using VectorFlavours = ::testing::Types<cont::Vector<std::string>, cont::SmallVector<std::string, 4>,
+    cont::SmallVector<std::string, 16>, cont::SmallVector<int, 4> >;
+TYPED_TEST_SUITE(SharedApi, VectorFlavours);
+
+TYPED_TEST(SharedApi, GrowShrinkAndEdit) {
+    using T = typename TypeParam::value_type;
+    auto make = [](int i) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            return std::string(24, static_cast<char>('a' + i % 26));
+        } else {
+            return i;
+        }
+    };
+    TypeParam v;
+    for (int i = 0; i < 10; i++) {
+        v.push_back(make(i));
+    }
+    EXPECT_EQ(v.size(), 10);
+    EXPECT_EQ(v.back(), make(9));
+    v.insert(0, make(20));
+    v.emplace(5, make(21));
+    v.erase(1);
+    EXPECT_EQ(v.front(), make(20));
+    EXPECT_EQ(v[4], make(21));
+    v.pop_back();
+    v.shrink_to_fit();
+    EXPECT_GE(v.capacity(), v.size());
+    v.resize(2);
+    v.shrink_to_fit();
+    EXPECT_EQ(v.size(), 2);
+    EXPECT_EQ(v[1], make(1));
+    T extra[] = {make(7), make(8), make(9)};
+    v.append_range(extra);
+    EXPECT_EQ(v.size(), 5);
+    EXPECT_EQ(v.at(4), make(9));
+    EXPECT_THROW(v.at(5), std::out_of_range);
+    v.clear();
+    EXPECT_TRUE(v.empty());
+}
+
+TYPED_TEST(SharedApi, CopyMoveAndSwapAcrossSizes) {
+    using T = typename TypeParam::value_type;
+    for (int small: {0, 3, 20}) {
+        for (int large: {0, 5, 40}) {
+            TypeParam a;
+            TypeParam b;
+            for (int i = 0; i < small; i++) {
+                a.push_back(T());
+            }
+            for (int i = 0; i < large; i++) {
+                b.resize(b.size() + 1);
+            }
+            TypeParam aCopy = a;
+            TypeParam bCopy(b);
+            EXPECT_EQ(aCopy, a);
+            a.swap(b);
+            EXPECT_EQ(a, bCopy);
+            EXPECT_EQ(b, aCopy);
+            TypeParam moved = std::move(a);
+            EXPECT_EQ(moved, bCopy);
+            EXPECT_TRUE(a.empty());
+            a = std::move(b);
+            EXPECT_EQ(a, aCopy);
+            b = a;
+            EXPECT_EQ(b, aCopy);
+            EXPECT_EQ(a <=> b, std::strong_ordering::equal);
+        }
+    }
+}
+
+TEST(SmallVector, StaysInlineUpToN) {
+    using Small = cont::SmallVector<std::string, 8, CountingAllocator<std::string> >;
+    AllocationStats stats;
+    {
+        Small v{CountingAllocator<std::string>(&stats)};
+        EXPECT_TRUE(v.is_inline());
+        EXPECT_EQ(v.capacity(), 8);
+        for (int i = 0; i < 8; i++) {
+            v.push_back(std::to_string(i));
+        }
+        EXPECT_TRUE(v.is_inline());
+        EXPECT_EQ(stats.calls, 0);
+        v.push_back("spill");
+        EXPECT_FALSE(v.is_inline());
+        EXPECT_EQ(stats.bytes, 16 * sizeof(std::string));
+        v.resize(3);
+        v.shrink_to_fit();
+        EXPECT_TRUE(v.is_inline());
+        EXPECT_EQ(v.capacity(), 8);
+        EXPECT_EQ(stats.live, 0);
+        EXPECT_EQ(v[2], "2");
+    }
+    EXPECT_EQ(stats.live, 0);
+}
+
+TEST(SmallVector, MoveOfInlineElements) {
+    cont::SmallVector<Owned, 4> v;
+    v.emplace_back(1);
+    v.emplace_back(2);
+    cont::SmallVector<Owned, 4> moved = std::move(v);
+    EXPECT_TRUE(moved.is_inline());
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(*moved[1].value, 2);
+    for (int i = 3; i <= 6; i++) {
+        moved.emplace_back(i);
+    }
+    const Owned *heap = moved.data();
+    v = std::move(moved);
+    EXPECT_EQ(v.data(), heap);
+    EXPECT_TRUE(moved.is_inline());
+    EXPECT_EQ(*v[5].value, 6);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -0,0 +1,29 @@
+#include "big_int.h"
+
+#include <chrono>
+
+int main() {
+    std::mt19937_64 rng(2024);
+
+    for (std::size_t bits : {1024, 2048}) {
+        const int count = 3;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; ++i) {
+            BigInt p = BigInt::random_prime(bits, rng);
+            if (i == 0) {
+                std::cout << bits << "-bit prime: " << p << std::endl;
+            }
+        }
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+        std::cout << bits << " bits: " << elapsed.count() / count << " ms per prime" << std::endl;
+    }
+
+    BigInt mod = BigInt::random_prime(1024, rng);
+    BigInt base = BigInt::random_bits(1000, rng);
+    BigInt exp = BigInt::random_bits(1024, rng);
+    auto start = std::chrono::steady_clock::now();
+    BigInt res = base.mod_exp(exp, mod);
+    auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+    std::cout << "1024-bit mod_exp: " << elapsed.count() << " ms" << std::endl;
+    return 0;
+}
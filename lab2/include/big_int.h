@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <complex>
 #include <cstdint>
+#include <random>
 
 #define BASE 1000000000
 #define SMALL_BASE 10000
@@ -18,6 +19,9 @@ private:
     std::vector<uint64_t> digits;
     bool isNegative;
 
+    static BigInt from_binary(const std::vector<uint32_t> &words);
+    [[nodiscard]] std::vector<uint32_t> to_binary() const;
+
 public:
     BigInt();
     explicit BigInt(long long value);
@@ -56,6 +60,9 @@ public:
     bool operator>=(const BigInt &other) const;
 
     [[nodiscard]] BigInt mod_exp(const BigInt &exp, const BigInt &mod) const;
+    [[nodiscard]] bool is_probable_prime(std::size_t rounds = 20) const;
+    static BigInt random_bits(std::size_t bits, std::mt19937_64 &rng);
+    static BigInt random_prime(std::size_t bits, std::mt19937_64 &rng);
     [[nodiscard]] BigInt fft_multiply(const BigInt &a);
     [[nodiscard]] BigInt fft_multiply2(const BigInt &a);
     [[nodiscard]] BigInt karatsuba_multiply(const BigInt &a) const;
@@ -390,7 +390,325 @@ BigInt BigInt::operator%(const BigInt &other) const {
     return result;
 }
 
+namespace {
+    const uint32_t SMALL_PRIME_LIMIT = 2000;
+
+    std::vector<uint32_t> small_primes() {
+        std::vector<bool> composite(SMALL_PRIME_LIMIT, false);
+        std::vector<uint32_t> primes;
+        for (uint32_t i = 2; i < SMALL_PRIME_LIMIT; ++i) {
+            if (!composite[i]) {
+                primes.push_back(i);
+                for (uint32_t j = i * i; j < SMALL_PRIME_LIMIT; j += i) {
+                    composite[j] = true;
+                }
+            }
+        }
+        return primes;
+    }
+
+    const std::vector<uint32_t> &sieve() {
+        static const std::vector<uint32_t> primes = small_primes();
+        return primes;
+    }
+
+    uint64_t mod_small(const std::vector<uint64_t> &digits, uint64_t p) {
+        uint64_t rem = 0;
+        for (std::size_t i = digits.size(); i-- > 0;) {
+            rem = (rem * BASE + digits[i]) % p;
+        }
+        return rem;
+    }
+
+    // Montgomery arithmetic with radix BASE, so the modulus must be coprime to 10.
+    class Montgomery {
+    private:
+        std::vector<uint64_t> m;
+        std::vector<uint64_t> t;
+        uint64_t mInv = 0;
+        std::size_t n = 0;
+
+        bool less_than_mod(const std::vector<uint64_t> &a) const {
+            for (std::size_t i = n; i-- > 0;) {
+                if (a[i] != m[i]) {
+                    return a[i] < m[i];
+                }
+            }
+            return false;
+        }
+
+        void sub_mod(std::vector<uint64_t> &a) const {
+            int64_t borrow = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                int64_t cur = static_cast<int64_t>(a[i]) - static_cast<int64_t>(m[i]) - borrow;
+                borrow = cur < 0;
+                a[i] = cur < 0 ? cur + BASE : cur;
+            }
+        }
+
+        void add_mod(std::vector<uint64_t> &a, const std::vector<uint64_t> &b) const {
+            uint64_t carry = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                uint64_t cur = a[i] + b[i] + carry;
+                a[i] = cur % BASE;
+                carry = cur / BASE;
+            }
+            if (carry != 0 || !less_than_mod(a)) {
+                sub_mod(a);
+            }
+        }
+
+        static uint64_t inverse(uint64_t a) {
+            int64_t old_r = static_cast<int64_t>(a), r = BASE;
+            int64_t old_s = 1, s = 0;
+            while (r != 0) {
+                int64_t q = old_r / r;
+                std::swap(old_r, r);
+                r -= q * old_r;
+                std::swap(old_s, s);
+                s -= q * old_s;
+            }
+            return old_s < 0 ? old_s + BASE : old_s;
+        }
+
+    public:
+        std::vector<uint64_t> r2;
+        std::vector<uint64_t> one;
+
+        explicit Montgomery(const std::vector<uint64_t> &mod) : m(mod), t(mod.size() + 2), n(mod.size()) {
+            mInv = BASE - inverse(m[0]);
+
+            // R^2 mod m is built from 1 by 2n multiplications by BASE = 10^9, each as 10 = 8 + 2.
+            r2.assign(n, 0);
+            r2[0] = 1;
+            if (n == 1 && m[0] == 1) {
+                r2[0] = 0;
+            }
+            for (std::size_t i = 0; i < 2 * n * 9; ++i) {
+                std::vector<uint64_t> twice = r2;
+                add_mod(twice, r2);
+                std::vector<uint64_t> eight = twice;
+                add_mod(eight, eight);
+                add_mod(eight, eight);
+                add_mod(eight, twice);
+                r2 = std::move(eight);
+            }
+            std::vector<uint64_t> unit(n, 0);
+            unit[0] = 1;
+            one.resize(n);
+            mul(unit, r2, one);
+        }
+
+        [[nodiscard]] std::size_t size() const {
+            return n;
+        }
+
+        void mul(const std::vector<uint64_t> &a, const std::vector<uint64_t> &b, std::vector<uint64_t> &out) {
+            std::fill(t.begin(), t.end(), 0);
+            for (std::size_t i = 0; i < n; ++i) {
+                uint64_t ai = a[i];
+                uint64_t carry = 0;
+                for (std::size_t j = 0; j < n; ++j) {
+                    uint64_t cur = t[j] + ai * b[j] + carry;
+                    t[j] = cur % BASE;
+                    carry = cur / BASE;
+                }
+                uint64_t cur = t[n] + carry;
+                t[n] = cur % BASE;
+                t[n + 1] += cur / BASE;
+
+                uint64_t u = (t[0] * mInv) % BASE;
+                carry = (t[0] + u * m[0]) / BASE;
+                for (std::size_t j = 1; j < n; ++j) {
+                    cur = t[j] + u * m[j] + carry;
+                    t[j - 1] = cur % BASE;
+                    carry = cur / BASE;
+                }
+                cur = t[n] + carry;
+                t[n - 1] = cur % BASE;
+                t[n] = t[n + 1] + cur / BASE;
+                t[n + 1] = 0;
+            }
+            if (t[n] != 0 || !less_than_mod(t)) {
+                sub_mod(t);
+            }
+            std::copy(t.begin(), t.begin() + n, out.begin());
+        }
+
+        // Fixed 4-bit window exponentiation over a Montgomery-form base.
+        std::vector<uint64_t> pow(const std::vector<uint64_t> &base, const std::vector<uint32_t> &exp) {
+            std::vector<std::vector<uint64_t>> table(16, std::vector<uint64_t>(n));
+            table[0] = one;
+            for (std::size_t i = 1; i < 16; ++i) {
+                mul(table[i - 1], base, table[i]);
+            }
+            std::vector<uint64_t> result = one;
+            for (std::size_t w = exp.size(); w-- > 0;) {
+                for (int shift = 28; shift >= 0; shift -= 4) {
+                    for (int k = 0; k < 4; ++k) {
+                        mul(result, result, result);
+                    }
+                    uint32_t window = (exp[w] >> shift) & 0xF;
+                    if (window != 0) {
+                        mul(result, table[window], result);
+                    }
+                }
+            }
+            return result;
+        }
+    };
+}
+
+std::vector<uint32_t> BigInt::to_binary() const {
+    std::vector<uint64_t> num = digits;
+    std::vector<uint32_t> words;
+    while (!num.empty() && !(num.size() == 1 && num[0] == 0)) {
+        uint64_t rem = 0;
+        for (std::size_t i = num.size(); i-- > 0;) {
+            uint64_t cur = rem * BASE + num[i];
+            num[i] = cur >> 32;
+            rem = cur & 0xFFFFFFFFu;
+        }
+        words.push_back(static_cast<uint32_t>(rem));
+        while (!num.empty() && num.back() == 0) {
+            num.pop_back();
+        }
+    }
+    return words;
+}
+
+BigInt BigInt::from_binary(const std::vector<uint32_t> &words) {
+    BigInt result;
+    result.digits.push_back(0);
+    for (std::size_t w = words.size(); w-- > 0;) {
+        uint64_t carry = words[w];
+        for (auto &digit : result.digits) {
+            uint64_t cur = (digit << 32) + carry;
+            digit = cur % BASE;
+            carry = cur / BASE;
+        }
+        while (carry != 0) {
+            result.digits.push_back(carry % BASE);
+            carry /= BASE;
+        }
+    }
+    result.remove_leading_zeros();
+    return result;
+}
+
+BigInt BigInt::random_bits(std::size_t bits, std::mt19937_64 &rng) {
+    std::vector<uint32_t> words((bits + 31) / 32);
+    for (auto &word : words) {
+        word = static_cast<uint32_t>(rng());
+    }
+    if (bits % 32 != 0) {
+        words.back() &= (1u << (bits % 32)) - 1;
+    }
+    return from_binary(words);
+}
+
+BigInt BigInt::random_prime(std::size_t bits, std::mt19937_64 &rng) {
+    if (bits < 2) {
+        throw std::invalid_argument("random_prime needs at least 2 bits");
+    }
+    std::vector<uint32_t> words((bits + 31) / 32);
+    while (true) {
+        for (auto &word : words) {
+            word = static_cast<uint32_t>(rng());
+        }
+        std::size_t top = (bits - 1) % 32;
+        if (top != 31) {
+            words.back() &= (1u << (top + 1)) - 1;
+        }
+        words.back() |= 1u << top;
+        words[0] |= 1u;
+        BigInt candidate = from_binary(words);
+        if (candidate.is_probable_prime()) {
+            return candidate;
+        }
+    }
+}
+
+bool BigInt::is_probable_prime(std::size_t rounds) const {
+    if (isNegative || is_zero()) {
+        return false;
+    }
+    const std::vector<uint32_t> &primes = sieve();
+    if (digits.size() == 1 && digits[0] < SMALL_PRIME_LIMIT) {
+        return std::binary_search(primes.begin(), primes.end(), digits[0]);
+    }
+    for (uint32_t p : primes) {
+        if (mod_small(digits, p) == 0) {
+            return false;
+        }
+    }
+    if (digits.size() == 1 && digits[0] < static_cast<uint64_t>(SMALL_PRIME_LIMIT) * SMALL_PRIME_LIMIT) {
+        return true;
+    }
+
+    BigInt d = *this;
+    d.digits[0] -= 1;
+    std::vector<uint32_t> dBits = d.to_binary();
+    std::size_t s = 0;
+    while (((dBits[s / 32] >> (s % 32)) & 1u) == 0) {
+        ++s;
+    }
+    std::vector<uint32_t> oddPart((dBits.size() * 32 - s + 31) / 32, 0);
+    for (std::size_t i = 0; i < dBits.size() * 32 - s; ++i) {
+        std::size_t from = i + s;
+        oddPart[i / 32] |= ((dBits[from / 32] >> (from % 32)) & 1u) << (i % 32);
+    }
+
+    Montgomery mont(digits);
+    std::size_t n = mont.size();
+    std::vector<uint64_t> minusOne = digits;
+    std::vector<uint64_t> monOne = mont.one;
+    int64_t borrow = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        int64_t cur = static_cast<int64_t>(minusOne[i]) - static_cast<int64_t>(monOne[i]) - borrow;
+        borrow = cur < 0;
+        minusOne[i] = cur < 0 ? cur + BASE : cur;
+    }
+
+    for (std::size_t r = 0; r < rounds && r < primes.size(); ++r) {
+        std::vector<uint64_t> a(n, 0);
+        a[0] = primes[r];
+        mont.mul(a, mont.r2, a);
+        std::vector<uint64_t> x = mont.pow(a, oddPart);
+        if (x == mont.one || x == minusOne) {
+            continue;
+        }
+        bool witness = true;
+        for (std::size_t i = 1; i < s && witness; ++i) {
+            mont.mul(x, x, x);
+            if (x == minusOne) {
+                witness = false;
+            }
+        }
+        if (witness) {
+            return false;
+        }
+    }
+    return true;
+}
+
 BigInt BigInt::mod_exp(const BigInt &exp, const BigInt &mod) const {
+    if (!isNegative && !exp.isNegative && !mod.isNegative && !mod.is_zero()
+        && mod.digits[0] % 2 != 0 && mod.digits[0] % 5 != 0) {
+        Montgomery mont(mod.digits);
+        BigInt reduced = *this < mod ? *this : *this % mod;
+        std::vector<uint64_t> base(mont.size(), 0);
+        std::copy(reduced.digits.begin(), reduced.digits.end(), base.begin());
+        mont.mul(base, mont.r2, base);
+        std::vector<uint64_t> power = mont.pow(base, exp.to_binary());
+        std::vector<uint64_t> unit(mont.size(), 0);
+        unit[0] = 1;
+        BigInt result;
+        result.digits.resize(mont.size());
+        mont.mul(power, unit, result.digits);
+        result.remove_leading_zeros();
+        return result;
+    }
     if (exp < BigInt(2)) {
         if (exp == BigInt(1)) {
             return *this % mod;
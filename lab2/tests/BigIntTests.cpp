@@ -152,6 +152,56 @@ TEST(BigIntTest, ModExp_ExponentZero_ReturnsOne) {
     EXPECT_EQ(result, BigInt("1"));
 }
 
+TEST(BigIntTest, ModExpMontgomery) {
+    BigInt base("71238548967123567235612386751823656182356781625348561234678578123457816234567817834578134658134568913456789136495619");
+    BigInt exp("25637467237845623785235");
+    BigInt mod("65537");
+    EXPECT_EQ(base.mod_exp(exp, mod), BigInt("13527"));
+}
+
+TEST(BigIntTest, ModExpMontgomeryFermat) {
+    BigInt p("170141183460469231731687303715884105727");
+    BigInt a("123456789123456789123456789");
+    EXPECT_EQ(a.mod_exp(p - BigInt(1), p), BigInt("1"));
+}
+
+TEST(BigIntTest, ProbablePrime) {
+    EXPECT_TRUE(BigInt("2").is_probable_prime());
+    EXPECT_TRUE(BigInt("1999").is_probable_prime());
+    EXPECT_TRUE(BigInt("1000000007").is_probable_prime());
+    EXPECT_TRUE(BigInt("170141183460469231731687303715884105727").is_probable_prime());
+    EXPECT_FALSE(BigInt("1").is_probable_prime());
+    EXPECT_FALSE(BigInt("561").is_probable_prime());
+    EXPECT_FALSE(BigInt("3825123056546413051").is_probable_prime());
+    EXPECT_FALSE(BigInt("-7").is_probable_prime());
+    EXPECT_FALSE((BigInt("1000000007") * BigInt("170141183460469231731687303715884105727")).is_probable_prime());
+}
+
+TEST(BigIntTest, RandomBits) {
+    std::mt19937_64 rng(42);
+    BigInt limit = BigInt(1);
+    for (int i = 0; i < 100; ++i) {
+        limit *= BigInt(2);
+    }
+    for (int i = 0; i < 20; ++i) {
+        BigInt r = BigInt::random_bits(100, rng);
+        EXPECT_TRUE(r < limit);
+        EXPECT_TRUE(r >= BigInt(0));
+    }
+}
+
+TEST(BigIntTest, RandomPrime) {
+    std::mt19937_64 rng(7);
+    BigInt low = BigInt(1);
+    for (int i = 0; i < 127; ++i) {
+        low *= BigInt(2);
+    }
+    BigInt p = BigInt::random_prime(128, rng);
+    EXPECT_TRUE(p >= low);
+    EXPECT_TRUE(p < low * BigInt(2));
+    EXPECT_TRUE(p.is_probable_prime());
+}
+
 TEST(BigIntTest, KaratsubaMultiply1) {
     BigInt a("123456789012345");
     BigInt b("987654321098765");